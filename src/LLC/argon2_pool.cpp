@@ -0,0 +1,269 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/argon2_pool.h>
+
+#include <Util/include/config.h>
+#include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+#include <Util/include/runtime.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+#include <new>
+
+#ifndef WIN32
+#include <sys/mman.h>
+#endif
+
+namespace LLC
+{
+
+    /** The size of a single argon2 memory block. **/
+    const size_t ARGON2_BLOCK_BYTES = 1024;
+
+
+    /** The arena offered to argon2 on this thread, nullptr when not hashing. **/
+    thread_local uint8_t* pArenaMemory = nullptr;
+
+
+    /** The size of the arena offered on this thread. **/
+    thread_local size_t nArenaBytes = 0;
+
+
+    /** Flag to track if argon2 has taken the arena on this thread. **/
+    thread_local bool fArenaClaimed = false;
+
+
+    /** Flag to track if argon2 needed more than the arena on this thread. **/
+    thread_local bool fArenaOversized = false;
+
+
+    /* Argon2 allocation hook handing out the arena for this thread. */
+    int arena_allocate(uint8_t** pMemory, size_t nBytes)
+    {
+        /* Use the arena when it is big enough. */
+        if(pArenaMemory && !fArenaClaimed && nBytes <= nArenaBytes)
+        {
+            fArenaClaimed = true;
+            *pMemory = pArenaMemory;
+
+            return ARGON2_OK;
+        }
+
+        /* Fall back to the heap for anything else. */
+        fArenaOversized = true;
+        *pMemory = static_cast<uint8_t*>(std::malloc(nBytes));
+
+        return *pMemory ? ARGON2_OK : ARGON2_MEMORY_ALLOCATION_ERROR;
+    }
+
+
+    /* Argon2 deallocation hook, arenas are kept for the next derivation. */
+    void arena_free(uint8_t* pMemory, size_t nBytes)
+    {
+        /* Argon2 has already wiped the memory before handing it back. */
+        if(pMemory == pArenaMemory)
+        {
+            fArenaClaimed = false;
+            return;
+        }
+
+        std::free(pMemory);
+    }
+
+
+    /* Constructor */
+    Argon2Pool::Argon2Pool(const uint32_t nMaxArenasIn, const size_t nArenaSizeIn)
+    : POOL_MUTEX ( )
+    , CONDITION  ( )
+    , vArenas    ( )
+    , vFree      ( )
+    , nMaxArenas (std::max(nMaxArenasIn, 1u))
+    , nArenaSize (nArenaSizeIn)
+    , stats      ( )
+    {
+    }
+
+
+    /* Destructor */
+    Argon2Pool::~Argon2Pool()
+    {
+        LOCK(POOL_MUTEX);
+
+        /* Unlock and free all of our arenas. */
+        for(auto& pArena : vArenas)
+        {
+        #ifndef WIN32
+            if(pArena->fLocked)
+                munlock(pArena->pMemory, pArena->nSize);
+        #endif
+
+            std::free(pArena->pMemory);
+            delete pArena;
+        }
+
+        vArenas.clear();
+        vFree.clear();
+    }
+
+
+    /* Get the global pool, sized from -argon2arenas and the largest argon2 memory cost. */
+    Argon2Pool& Argon2Pool::GetInstance()
+    {
+        /* Genesis and seed phrase keys always use 64 MB, other keys use -argon2_memory. */
+        static Argon2Pool POOL(
+            static_cast<uint32_t>(config::GetArg("-argon2arenas", 2)),
+            ARGON2_BLOCK_BYTES * std::max(uint64_t(1) << 16, uint64_t(1) << std::max(4u, uint32_t(config::GetArg("-argon2_memory", 16)))));
+
+        return POOL;
+    }
+
+
+    /* Run an argon2id computation using one of our arenas. */
+    int32_t Argon2Pool::Hash(argon2_context& context)
+    {
+        /* Wait for our arena. */
+        runtime::timer timer;
+        timer.Start();
+
+        Arena* pArena = acquire();
+        const uint64_t nWaitTime = timer.ElapsedMicroseconds();
+
+        /* Offer the arena to argon2 on this thread. */
+        pArenaMemory    = pArena->pMemory;
+        nArenaBytes     = pArena->nSize;
+        fArenaClaimed   = false;
+        fArenaOversized = false;
+
+        context.allocate_cbk = &arena_allocate;
+        context.free_cbk     = &arena_free;
+
+        /* Run the argon2 computation. */
+        timer.Reset();
+        int32_t nRet = argon2id_ctx(&context);
+        const uint64_t nHashTime = timer.ElapsedMicroseconds();
+
+        /* Take the arena back from this thread. */
+        pArenaMemory = nullptr;
+        nArenaBytes  = 0;
+
+        /* Record our stats. */
+        {
+            LOCK(POOL_MUTEX);
+
+            ++stats.nDerived;
+            if(fArenaOversized)
+                ++stats.nOversized;
+
+            stats.nWaitTime += nWaitTime;
+            stats.nHashTime += nHashTime;
+        }
+
+        release(pArena);
+
+        return nRet;
+    }
+
+
+    /* Get a copy of the derivation counters. */
+    Argon2Pool::Stats Argon2Pool::GetStats() const
+    {
+        LOCK(POOL_MUTEX);
+        return stats;
+    }
+
+
+    /* Get a free arena, creating one if under our limit, waiting otherwise. */
+    Argon2Pool::Arena* Argon2Pool::acquire()
+    {
+        {
+            std::unique_lock<std::mutex> lock(POOL_MUTEX);
+
+            /* Wait in turn if every arena is busy and we can't make more. */
+            if(vFree.empty() && stats.nArenas >= nMaxArenas)
+            {
+                ++stats.nWaiting;
+                stats.nPeakWaiting = std::max(stats.nPeakWaiting, stats.nWaiting);
+
+                CONDITION.wait(lock, [this]{ return !vFree.empty() || stats.nArenas < nMaxArenas; });
+
+                --stats.nWaiting;
+            }
+
+            /* Reuse a free arena. */
+            if(!vFree.empty())
+            {
+                Arena* pArena = vFree.back();
+                vFree.pop_back();
+
+                return pArena;
+            }
+
+            /* Reserve our new arena so we can build it outside of the lock. */
+            ++stats.nArenas;
+        }
+
+        /* Create a new arena, faulting in every page now rather than during the hash. */
+        Arena* pArena = new Arena();
+        pArena->nSize   = nArenaSize;
+        pArena->pMemory = static_cast<uint8_t*>(std::malloc(nArenaSize));
+        pArena->fLocked = false;
+
+        /* Give our reservation back if we are out of memory. */
+        if(!pArena->pMemory)
+        {
+            delete pArena;
+            {
+                LOCK(POOL_MUTEX);
+                --stats.nArenas;
+            }
+
+            /* Let a waiting caller take the reservation we just gave back. */
+            CONDITION.notify_one();
+
+            throw std::bad_alloc();
+        }
+
+        std::memset(pArena->pMemory, 0, nArenaSize);
+
+        /* Keep key material out of swap when we are allowed to. */
+    #ifndef WIN32
+        pArena->fLocked = (mlock(pArena->pMemory, nArenaSize) == 0);
+        if(!pArena->fLocked)
+            debug::log(2, FUNCTION, "could not lock ", nArenaSize / (1024 * 1024), " MB argon2 arena");
+    #endif
+
+        {
+            LOCK(POOL_MUTEX);
+            vArenas.push_back(pArena);
+
+            if(pArena->fLocked)
+                ++stats.nLocked;
+        }
+
+        return pArena;
+    }
+
+
+    /* Return an arena to the pool and wake the next waiting caller. */
+    void Argon2Pool::release(Arena* pArena)
+    {
+        {
+            LOCK(POOL_MUTEX);
+            vFree.push_back(pArena);
+        }
+        CONDITION.notify_one();
+    }
+}
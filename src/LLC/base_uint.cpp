@@ -328,17 +328,29 @@ template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator*=(const base_uint<BITS>& b)
 {
     base_uint<BITS> a;
-    a = 0u;
 
-    for(int j = 0; j < WIDTH; j++)
+    /* Only multiply the significant words, the products of leading zeros are zero. */
+    const uint32_t nWordsA = words();
+    const uint32_t nWordsB = b.words();
+
+    for(uint32_t j = 0; j < nWordsA; ++j)
     {
+        /* Skip rows that add nothing. */
+        if(pn[j] == 0)
+            continue;
+
         uint64_t carry = 0;
-        for(int i = 0; i + j < WIDTH; i++)
+        uint32_t i = 0;
+        for(; i < nWordsB && i + j < WIDTH; ++i)
         {
             uint64_t n = carry + a.pn[i + j] + (uint64_t)pn[j] * b.pn[i];
             a.pn[i + j] = n & 0xffffffff;
             carry = n >> 32;
         }
+
+        /* Earlier rows never reach this word, so the carry lands on a zero. */
+        if(i + j < WIDTH)
+            a.pn[i + j] = static_cast<uint32_t>(carry);
     }
     *this = a;
 
@@ -350,23 +362,18 @@ base_uint<BITS>& base_uint<BITS>::operator*=(const base_uint<BITS>& b)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator*=(uint64_t n)
 {
-    base_uint<BITS> a;
-    a = 0u;
-
-    base_uint<BITS> b;
-    b = n;
+    /* Use the general multiply for full 64-bit values. */
+    if(n >> 32)
+        return *this *= base_uint<BITS>(n);
 
-    for(int j = 0; j < WIDTH; j++)
+    /* Single pass for 32-bit multipliers. */
+    uint64_t carry = 0;
+    for(uint32_t i = 0; i < WIDTH; ++i)
     {
-        uint64_t carry = 0;
-        for(int i = 0; i + j < WIDTH; i++)
-        {
-            uint64_t n = carry + a.pn[i + j] + (uint64_t)pn[j] * b.pn[i];
-            a.pn[i + j] = n & 0xffffffff;
-            carry = n >> 32;
-        }
+        uint64_t p = carry + (uint64_t)pn[i] * n;
+        pn[i] = p & 0xffffffff;
+        carry = p >> 32;
     }
-    *this = a;
 
     return *this;
 }
@@ -377,35 +384,100 @@ base_uint<BITS>& base_uint<BITS>::operator*=(uint64_t n)
 template<uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::operator/=(const base_uint<BITS>& b)
 {
-    base_uint<BITS> div = b;     // make a copy, so we can shift.
-    base_uint<BITS> num = *this; // make a copy, so we can subtract.
-    *this = 0;                   // the quotient.
-
-    int num_bits = num.bits();
-    int div_bits = div.bits();
+    /* Get the significant words of our divisor and dividend. */
+    const uint32_t n = b.words();
+    const uint32_t m = words();
 
-    if(div_bits == 0)
+    if(n == 0)
         throw std::domain_error("Division by zero");
 
-    if(div_bits > num_bits) // the result is certainly 0.
+    /* The result is certainly 0. */
+    if(m < n)
+        return *this = 0;
+
+    /* Short division for single word divisors. */
+    if(n == 1)
+    {
+        const uint64_t d = b.pn[0];
+
+        uint64_t r = 0;
+        for(int32_t i = m - 1; i >= 0; --i)
+        {
+            uint64_t num = (r << 32) | pn[i];
+            pn[i] = static_cast<uint32_t>(num / d);
+            r = num % d;
+        }
+
         return *this;
+    }
+
+    /* Knuth algorithm D. Normalize so the divisor's top word has its high bit set. */
+    uint32_t s = 0;
+    while(!(b.pn[n - 1] & (0x80000000 >> s)))
+        ++s;
+
+    uint32_t vn[WIDTH];
+    uint32_t un[WIDTH + 1];
 
-    int shift = num_bits - div_bits;
+    for(uint32_t i = n - 1; i > 0; --i)
+        vn[i] = (b.pn[i] << s) | (s ? b.pn[i - 1] >> (32 - s) : 0);
+    vn[0] = b.pn[0] << s;
 
-    div <<= shift; // shift so that div and num align.
-    while(shift >= 0)
+    un[m] = s ? pn[m - 1] >> (32 - s) : 0;
+    for(uint32_t i = m - 1; i > 0; --i)
+        un[i] = (pn[i] << s) | (s ? pn[i - 1] >> (32 - s) : 0);
+    un[0] = pn[0] << s;
+
+    /* The quotient replaces us. */
+    for(uint32_t i = 0; i < WIDTH; ++i)
+        pn[i] = 0;
+
+    for(int32_t j = m - n; j >= 0; --j)
     {
-        if(num >= div)
+        /* Estimate the quotient word from the top two words, correcting it at most twice. */
+        uint64_t num  = ((uint64_t)un[j + n] << 32) | un[j + n - 1];
+        uint64_t qhat = num / vn[n - 1];
+        uint64_t rhat = num % vn[n - 1];
+
+        while(qhat > 0xffffffff || qhat * vn[n - 2] > ((rhat << 32) | un[j + n - 2]))
         {
-            num -= div;
-            pn[shift >> 5] |= (1 << (shift & 31)); // set a bit of the result.
+            --qhat;
+            rhat += vn[n - 1];
+            if(rhat > 0xffffffff)
+                break;
         }
 
-        div >>= 1; // shift back.
-        --shift;
+        /* Multiply and subtract. */
+        int64_t k = 0;
+        int64_t t = 0;
+        for(uint32_t i = 0; i < n; ++i)
+        {
+            uint64_t p = qhat * vn[i];
+            t = un[i + j] - k - (int64_t)(p & 0xffffffff);
+            un[i + j] = static_cast<uint32_t>(t);
+            k = (int64_t)(p >> 32) - (t >> 32);
+        }
+        t = un[j + n] - k;
+        un[j + n] = static_cast<uint32_t>(t);
+
+        /* Add back if we subtracted too much. */
+        if(t < 0)
+        {
+            --qhat;
+
+            uint64_t carry = 0;
+            for(uint32_t i = 0; i < n; ++i)
+            {
+                uint64_t sum = (uint64_t)un[i + j] + vn[i] + carry;
+                un[i + j] = static_cast<uint32_t>(sum);
+                carry = sum >> 32;
+            }
+            un[j + n] += static_cast<uint32_t>(carry);
+        }
+
+        pn[j] = static_cast<uint32_t>(qhat);
     }
 
-    // num now contains the remainder of the division.
     return *this;
 }
 
@@ -476,15 +548,7 @@ const base_uint<BITS> base_uint<BITS>::operator--(int)
 template<uint32_t BITS>
 bool base_uint<BITS>::operator<(const base_uint<BITS>& n) const
 {
-    for(int8_t i = WIDTH-1; i >= 0; --i)
-    {
-        if(this->pn[i] < n.pn[i])
-            return true;
-        else if(this->pn[i] > n.pn[i])
-            return false;
-    }
-
-    return false;
+    return CompareTo(n) < 0;
 }
 
 
@@ -492,15 +556,7 @@ bool base_uint<BITS>::operator<(const base_uint<BITS>& n) const
 template<uint32_t BITS>
 bool base_uint<BITS>::operator<=(const base_uint<BITS>& n) const
 {
-    for(int8_t i = WIDTH-1; i >= 0; --i)
-    {
-        if(this->pn[i] < n.pn[i])
-            return true;
-        else if(this->pn[i] > n.pn[i])
-            return false;
-    }
-
-    return true;
+    return CompareTo(n) <= 0;
 }
 
 
@@ -508,15 +564,7 @@ bool base_uint<BITS>::operator<=(const base_uint<BITS>& n) const
 template<uint32_t BITS>
 bool base_uint<BITS>::operator>(const base_uint<BITS>& n) const
 {
-    for(int8_t i = WIDTH-1; i >= 0; --i)
-    {
-        if(this->pn[i] > n.pn[i])
-            return true;
-        else if(this->pn[i] < n.pn[i])
-            return false;
-    }
-
-    return false;
+    return CompareTo(n) > 0;
 }
 
 
@@ -524,15 +572,7 @@ bool base_uint<BITS>::operator>(const base_uint<BITS>& n) const
 template<uint32_t BITS>
 bool base_uint<BITS>::operator>=(const base_uint<BITS>& n) const
 {
-    for(int8_t i = WIDTH-1; i >= 0; --i)
-    {
-        if(this->pn[i] > n.pn[i])
-            return true;
-        else if(this->pn[i] < n.pn[i])
-            return false;
-    }
-
-    return true;
+    return CompareTo(n) >= 0;
 }
 
 
@@ -540,11 +580,12 @@ bool base_uint<BITS>::operator>=(const base_uint<BITS>& n) const
 template<uint32_t BITS>
 bool base_uint<BITS>::operator==(const base_uint<BITS>& n) const
 {
-    for(uint8_t i = 0; i < WIDTH; ++i)
-        if(this->pn[i] != n.pn[i])
-            return false;
+    /* Accumulate the differences without branching so the loop vectorizes. */
+    uint32_t nDiff = 0;
+    for(uint32_t i = 0; i < WIDTH; ++i)
+        nDiff |= pn[i] ^ n.pn[i];
 
-    return true;
+    return nDiff == 0;
 }
 
 
@@ -796,23 +837,51 @@ uint32_t base_uint<BITS>::high_bits(uint32_t mask)
 template <uint32_t BITS>
 uint32_t base_uint<BITS>::bits() const
 {
-    for(int32_t pos = WIDTH - 1; pos >= 0; --pos)
+    const uint32_t nWords = words();
+    if(nWords == 0)
+        return 0;
+
+    /* Find the highest bit of the top word. */
+    const uint32_t nTop = pn[nWords - 1];
+#if defined(__GNUC__)
+    return 32 * nWords - __builtin_clz(nTop);
+#else
+    uint32_t nBits = 32;
+    while(!(nTop & (1U << (nBits - 1))))
+        --nBits;
+
+    return 32 * (nWords - 1) + nBits;
+#endif
+}
+
+
+/*  Compares against another base_uint of the same width. */
+template <uint32_t BITS>
+int32_t base_uint<BITS>::CompareTo(const base_uint<BITS>& n) const
+{
+    /* The first differing word from the top decides, values that share their high words are common. */
+    for(int32_t i = WIDTH - 1; i >= 0; --i)
     {
-        if(pn[pos])
-        {
-            for(int32_t nbits = 31; nbits > 0; --nbits)
-            {
-                if(pn[pos] & 1U << nbits)
-                    return 32 * pos + nbits + 1;
-            }
-            return 32 * pos + 1;
-        }
+        if(pn[i] != n.pn[i])
+            return pn[i] < n.pn[i] ? -1 : 1;
     }
 
     return 0;
 }
 
 
+/*  Returns the number of significant 32-bit words, ignoring leading zero words. */
+template <uint32_t BITS>
+uint32_t base_uint<BITS>::words() const
+{
+    uint32_t nWords = WIDTH;
+    while(nWords > 0 && pn[nWords - 1] == 0)
+        --nWords;
+
+    return nWords;
+}
+
+
 
 template <uint32_t BITS>
 base_uint<BITS>& base_uint<BITS>::SetCompact(uint32_t nCompact)
@@ -777,3 +777,155 @@ falcon_verify(const void *sig, size_t sig_len,
 	return falcon_verify_finish(sig, sig_len,
 		pubkey, pubkey_len, &hd, tmp, tmp_len);
 }
+
+/* see falcon.h */
+int
+falcon_expand_pubkey(void *expanded_pubkey, size_t expanded_pubkey_len,
+	const void *pubkey, size_t pubkey_len)
+{
+	unsigned logn;
+	const uint8_t *pk;
+	uint8_t *ek;
+	uint16_t *h;
+
+	/*
+	 * Get Falcon degree from public key and check parameters.
+	 */
+	if (pubkey_len == 0) {
+		return FALCON_ERR_FORMAT;
+	}
+	pk = pubkey;
+	if ((pk[0] & 0xF0) != 0x00) {
+		return FALCON_ERR_FORMAT;
+	}
+	logn = pk[0] & 0x0F;
+	if (logn < 1 || logn > 10) {
+		return FALCON_ERR_FORMAT;
+	}
+	if (pubkey_len != FALCON_PUBKEY_SIZE(logn)) {
+		return FALCON_ERR_FORMAT;
+	}
+	if (expanded_pubkey_len < FALCON_EXPANDEDPUBKEY_SIZE(logn)) {
+		return FALCON_ERR_SIZE;
+	}
+
+	/*
+	 * Expanded key starts with the same header byte as the public
+	 * key, followed by the aligned NTT representation of h.
+	 */
+	ek = expanded_pubkey;
+	ek[0] = pk[0];
+	h = (uint16_t *)align_u16(ek + 1);
+
+	/*
+	 * Decode public key.
+	 */
+	if (Zf(modq_decode)(h, logn, pk + 1, pubkey_len - 1)
+		!= pubkey_len - 1)
+	{
+		return FALCON_ERR_FORMAT;
+	}
+
+	/*
+	 * Convert to NTT + Montgomery representation for verify_raw().
+	 */
+	Zf(to_ntt_monty)(h, logn);
+	return 0;
+}
+
+/* see falcon.h */
+int
+falcon_verify_expanded(const void *sig, size_t sig_len,
+	const void *expanded_pubkey, size_t expanded_pubkey_len,
+	const void *data, size_t data_len,
+	void *tmp, size_t tmp_len)
+{
+	shake256_context hd;
+	unsigned logn;
+	uint8_t *atmp;
+	const uint8_t *ek, *es;
+	int ct;
+	size_t u, v, n;
+	const uint16_t *h;
+	uint16_t *hm;
+	int16_t *sv;
+
+	/*
+	 * Get Falcon degree from expanded public key; verify consistency
+	 * with signature value, and check parameters.
+	 */
+	if (sig_len < 41 || expanded_pubkey_len == 0) {
+		return FALCON_ERR_FORMAT;
+	}
+	es = sig;
+	ek = expanded_pubkey;
+	if ((ek[0] & 0xF0) != 0x00) {
+		return FALCON_ERR_FORMAT;
+	}
+	logn = ek[0] & 0x0F;
+	if (logn < 1 || logn > 10) {
+		return FALCON_ERR_FORMAT;
+	}
+	switch (es[0] & 0xF0) {
+	case 0x30:
+		ct = 0;
+		break;
+	case 0x50:
+		ct = 1;
+		break;
+	default:
+		return FALCON_ERR_FORMAT;
+	}
+	if ((es[0] & 0x0F) != logn) {
+		return FALCON_ERR_BADSIG;
+	}
+	if (expanded_pubkey_len < FALCON_EXPANDEDPUBKEY_SIZE(logn)) {
+		return FALCON_ERR_FORMAT;
+	}
+	if (tmp_len < FALCON_TMPSIZE_VERIFY(logn)) {
+		return FALCON_ERR_SIZE;
+	}
+
+	n = (size_t)1 << logn;
+	h = (const uint16_t *)align_u16((void *)(ek + 1));
+	hm = (uint16_t *)align_u16(tmp);
+	sv = (int16_t *)(hm + n);
+	atmp = (uint8_t *)(sv + n);
+
+	/*
+	 * Decode signature value.
+	 */
+	u = 41;
+	if (ct) {
+		v = Zf(trim_i16_decode)(sv, logn,
+			Zf(max_sig_bits)[logn], es + u, sig_len - u);
+	} else {
+		v = Zf(comp_decode)(sv, logn, es + u, sig_len - u);
+	}
+	if (v == 0 || (u + v) != sig_len) {
+		return FALCON_ERR_FORMAT;
+	}
+
+	/*
+	 * Hash nonce and message to point.
+	 */
+	shake256_init(&hd);
+	shake256_inject(&hd, es + 1, 40);
+	shake256_inject(&hd, data, data_len);
+	shake256_flip(&hd);
+	if (ct) {
+		Zf(hash_to_point_ct)(
+			(inner_shake256_context *)&hd, hm, logn, atmp);
+	} else {
+		Zf(hash_to_point_vartime)(
+			(inner_shake256_context *)&hd, hm, logn);
+	}
+
+	/*
+	 * Verify signature.
+	 */
+	if (!Zf(verify_raw)(hm, sv, h, logn, atmp)) {
+		return FALCON_ERR_BADSIG;
+	}
+	return 0;
+}
@@ -335,6 +335,12 @@ extern "C" {
 #define FALCON_TMPSIZE_VERIFY(logn) \
 	((8u << (logn)) + 1)
 
+/*
+ * Size of an expanded public key.
+ */
+#define FALCON_EXPANDEDPUBKEY_SIZE(logn) \
+	((2u << (logn)) + 2)
+
 /* ==================================================================== */
 /*
  * SHAKE256.
@@ -725,6 +731,40 @@ int falcon_verify_finish(const void *sig, size_t sig_len,
 	shake256_context *hash_data,
 	void *tmp, size_t tmp_len);
 
+/*
+ * Expand a public key. The provided Falcon public key (pubkey, of size
+ * pubkey_len bytes) is decoded and converted to NTT representation into
+ * expanded_pubkey[], so that many signatures can be verified against it
+ * without decoding it again each time.
+ *
+ * The expanded_pubkey[] buffer has size expanded_pubkey_len, which MUST
+ * be at least FALCON_EXPANDEDPUBKEY_SIZE(logn) bytes (where 'logn'
+ * qualifies the Falcon degree encoded in the public key and can be
+ * obtained with falcon_get_logn()). Expanded public keys may be moved in
+ * RAM only if their 2-byte alignment remains unchanged.
+ *
+ * Returned value: 0 on success, or a negative error code.
+ */
+int falcon_expand_pubkey(void *expanded_pubkey, size_t expanded_pubkey_len,
+	const void *pubkey, size_t pubkey_len);
+
+/*
+ * Verify the signature sig[] (of length sig_len bytes) with regards to
+ * the expanded public key held in expanded_pubkey[], as generated by
+ * falcon_expand_pubkey(), and the message data[] (of length data_len
+ * bytes). The result is the same as falcon_verify() with the original
+ * public key.
+ *
+ * The tmp[] buffer is used to hold temporary values. Its size tmp_len
+ * MUST be at least FALCON_TMPSIZE_VERIFY(logn) bytes.
+ *
+ * Returned value: 0 on success, or a negative error code.
+ */
+int falcon_verify_expanded(const void *sig, size_t sig_len,
+	const void *expanded_pubkey, size_t expanded_pubkey_len,
+	const void *data, size_t data_len,
+	void *tmp, size_t tmp_len);
+
 /* ==================================================================== */
 
 #ifdef __cplusplus
@@ -19,8 +19,28 @@ ________________________________________________________________________________
 
 #include <LLC/include/flkey.h>
 
+#include <LLD/cache/template_lru.h>
+
+#include <Util/include/args.h>
+
+#include <memory>
+
 namespace LLC
 {
+
+    /** Temporary memory for verifying signatures on this thread. **/
+    thread_local uint8_t VERIFY_TEMP[FALCON_TMPSIZE_VERIFY(9)];
+
+
+    /* Get the cache of expanded public keys, sized from -falconcache. */
+    LLD::TemplateLRU<std::vector<uint8_t>, std::shared_ptr<const std::vector<uint8_t>>>& expanded_cache()
+    {
+        static LLD::TemplateLRU<std::vector<uint8_t>, std::shared_ptr<const std::vector<uint8_t>>> CACHE(
+            static_cast<uint32_t>(config::GetArg("-falconcache", 1024)));
+
+        return CACHE;
+    }
+
     /* The default constructor. */
     FLKey::FLKey()
     : vchPubKey   ( )
@@ -226,11 +246,57 @@ namespace LLC
         if(!fSet || vchPubKey.empty())
             return false;
 
-        /* Create temp memory. */
-        std::vector<uint8_t> vchTemp(FALCON_TMPSIZE_VERIFY(9), 0);
+        /* Check the cache for our expanded public key. */
+        std::shared_ptr<const std::vector<uint8_t>> pExpanded;
+        if(!expanded_cache().Get(vchPubKey, pExpanded))
+        {
+            /* Expand the public key once for all of its signatures. */
+            std::shared_ptr<std::vector<uint8_t>> pNew = std::make_shared<std::vector<uint8_t>>();
+            if(!ExpandPubKey(vchPubKey, *pNew))
+                return false;
+
+            pExpanded = pNew;
+            expanded_cache().Put(vchPubKey, pExpanded);
+        }
+
+        return VerifyExpanded(*pExpanded, vchData, vchSig);
+    }
+
+
+    /* Decode a public key and convert it to NTT form. */
+    bool FLKey::ExpandPubKey(const std::vector<uint8_t>& vchPubKey, std::vector<uint8_t>& vchExpanded)
+    {
+        /* Get the degree of the key, the key size is checked while expanding. */
+        if(vchPubKey.empty())
+            return false;
+
+        const int32_t nLogN = falcon_get_logn((void*)&vchPubKey[0], vchPubKey.size());
+        if(nLogN < 0)
+            return false;
+
+        /* Expand the public key. */
+        vchExpanded.resize(FALCON_EXPANDEDPUBKEY_SIZE(nLogN));
+        if(falcon_expand_pubkey(&vchExpanded[0], vchExpanded.size(), &vchPubKey[0], vchPubKey.size()))
+        {
+            vchExpanded.clear();
+            return false;
+        }
+
+        return true;
+    }
+
+
+    /* Signature Verification Function against an expanded public key. */
+    bool FLKey::VerifyExpanded(const std::vector<uint8_t>& vchExpanded,
+                               const std::vector<uint8_t>& vchData, const std::vector<uint8_t>& vchSig)
+    {
+        /* Check for an expanded key. */
+        if(vchExpanded.empty())
+            return false;
 
         /* Verify the signed message. */
-        if(falcon_verify(&vchSig[0], vchSig.size(), &vchPubKey[0], vchPubKey.size(), &vchData[0], vchData.size(), &vchTemp[0], vchTemp.size()))
+        if(falcon_verify_expanded(vchSig.data(), vchSig.size(), &vchExpanded[0], vchExpanded.size(),
+            vchData.data(), vchData.size(), VERIFY_TEMP, sizeof(VERIFY_TEMP)))
             return false;
 
         return true;
@@ -0,0 +1,405 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/batch.h>
+#include <LLC/hash/SK/skein.h>
+#include <LLC/hash/SK/KeccakHash.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace LLC
+{
+
+    /* Hash a single message the same as SK512, without going through the hash cache. */
+    void sk512_scalar(const uint8_t* pData, const uint64_t nLength, uint512_t& hash)
+    {
+        uint512_t hashSkein;
+        Skein_512_Ctxt_t ctxSkein;
+        Skein_512_Init  (&ctxSkein, 512);
+        Skein_512_Update(&ctxSkein, pData, nLength);
+        Skein_512_Final (&ctxSkein, (uint8_t *)&hashSkein);
+
+        Keccak_HashInstance ctxKeccak;
+        Keccak_HashInitialize_SHA3_512(&ctxKeccak);
+        Keccak_HashUpdate(&ctxKeccak, (uint8_t *)&hashSkein, 512);
+        Keccak_HashFinal(&ctxKeccak, (uint8_t *)&hash);
+    }
+
+
+#if defined(__GNUC__) && defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+#define SK512_VECTOR
+
+    /** Four 64-bit words, one for each message being hashed. **/
+    typedef uint64_t lane_t __attribute__((vector_size(32)));
+
+
+    /** The number of messages hashed together. **/
+    const uint32_t SK512_LANES = 4;
+
+
+    /** Skein-512 rotation constants, matching R_512 in skein.h. **/
+    const uint32_t SKEIN_512_ROTATIONS[8][4] =
+    {
+        {38, 30, 50, 53},
+        {48, 20, 43, 31},
+        {34, 14, 15, 27},
+        {26, 12, 58,  7},
+        {33, 49,  8, 42},
+        {39, 27, 41, 14},
+        {29, 26, 11,  9},
+        {33, 51, 39, 35}
+    };
+
+
+    /** Keccak-f[1600] round constants. **/
+    const uint64_t KECCAK_ROUND_CONSTANTS[24] =
+    {
+        0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL, 0x8000000080008000ULL,
+        0x000000000000808BULL, 0x0000000080000001ULL, 0x8000000080008081ULL, 0x8000000000008009ULL,
+        0x000000000000008AULL, 0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+        0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL, 0x8000000000008003ULL,
+        0x8000000000008002ULL, 0x8000000000000080ULL, 0x000000000000800AULL, 0x800000008000000AULL,
+        0x8000000080008081ULL, 0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+    };
+
+
+    /** Keccak-f[1600] rho rotations, in pi lane order. **/
+    const uint32_t KECCAK_ROTATIONS[24] =
+    {
+         1,  3,  6, 10, 15, 21, 28, 36, 45, 55,  2, 14, 27, 41, 56,  8, 25, 43, 62, 18, 39, 61, 20, 44
+    };
+
+
+    /** Keccak-f[1600] pi lane order. **/
+    const uint32_t KECCAK_PI_LANES[24] =
+    {
+        10,  7, 11, 17, 18,  3,  5, 16,  8, 21, 24,  4, 15, 23, 19, 13, 12,  2, 20, 14, 22,  9,  6,  1
+    };
+
+
+    /* Rotate each lane left, a macro so no vectors are passed by value without AVX enabled. */
+#define ROTL_LANES(x, n) (((x) << (n)) | ((x) >> (64 - (n))))
+
+
+    /* Run one Skein-512 UBI block on every lane: X = Threefish(X, T, W) ^ W */
+    inline __attribute__((always_inline)) void skein512_block(lane_t* X, const lane_t* w, const uint64_t t0, const uint64_t t1)
+    {
+        /* Build the key schedule. */
+        lane_t ks[9];
+        ks[8] = X[0] ^ X[1] ^ X[2] ^ X[3] ^ X[4] ^ X[5] ^ X[6] ^ X[7] ^ SKEIN_KS_PARITY;
+        for(uint32_t i = 0; i < 8; ++i)
+            ks[i] = X[i];
+
+        const uint64_t ts[3] = { t0, t1, t0 ^ t1 };
+
+        /* First key injection. */
+        lane_t x[8];
+        for(uint32_t i = 0; i < 8; ++i)
+            x[i] = w[i] + ks[i];
+
+        x[5] += ts[0];
+        x[6] += ts[1];
+
+        /* Eight rounds between each key injection. */
+        for(uint32_t r = 0; r < SKEIN_512_ROUNDS_TOTAL / 4; r += 2)
+        {
+            for(uint32_t s = 0; s < 2; ++s)
+            {
+                const uint32_t (*R)[4] = &SKEIN_512_ROTATIONS[s * 4];
+
+                x[0] += x[1]; x[1] = ROTL_LANES(x[1], R[0][0]) ^ x[0];
+                x[2] += x[3]; x[3] = ROTL_LANES(x[3], R[0][1]) ^ x[2];
+                x[4] += x[5]; x[5] = ROTL_LANES(x[5], R[0][2]) ^ x[4];
+                x[6] += x[7]; x[7] = ROTL_LANES(x[7], R[0][3]) ^ x[6];
+
+                x[2] += x[1]; x[1] = ROTL_LANES(x[1], R[1][0]) ^ x[2];
+                x[4] += x[7]; x[7] = ROTL_LANES(x[7], R[1][1]) ^ x[4];
+                x[6] += x[5]; x[5] = ROTL_LANES(x[5], R[1][2]) ^ x[6];
+                x[0] += x[3]; x[3] = ROTL_LANES(x[3], R[1][3]) ^ x[0];
+
+                x[4] += x[1]; x[1] = ROTL_LANES(x[1], R[2][0]) ^ x[4];
+                x[6] += x[3]; x[3] = ROTL_LANES(x[3], R[2][1]) ^ x[6];
+                x[0] += x[5]; x[5] = ROTL_LANES(x[5], R[2][2]) ^ x[0];
+                x[2] += x[7]; x[7] = ROTL_LANES(x[7], R[2][3]) ^ x[2];
+
+                x[6] += x[1]; x[1] = ROTL_LANES(x[1], R[3][0]) ^ x[6];
+                x[0] += x[7]; x[7] = ROTL_LANES(x[7], R[3][1]) ^ x[0];
+                x[2] += x[5]; x[5] = ROTL_LANES(x[5], R[3][2]) ^ x[2];
+                x[4] += x[3]; x[3] = ROTL_LANES(x[3], R[3][3]) ^ x[4];
+
+                /* Inject the key schedule. */
+                const uint32_t nInject = r + s;
+                for(uint32_t i = 0; i < 8; ++i)
+                    x[i] += ks[(nInject + 1 + i) % 9];
+
+                x[5] += ts[(nInject + 1) % 3];
+                x[6] += ts[(nInject + 2) % 3];
+                x[7] += uint64_t(nInject + 1);
+            }
+        }
+
+        /* Feed forward. */
+        for(uint32_t i = 0; i < 8; ++i)
+            X[i] = x[i] ^ w[i];
+    }
+
+
+    /* Run the Keccak-f[1600] permutation on every lane. */
+    inline __attribute__((always_inline)) void keccak_permute(lane_t* A)
+    {
+        for(uint32_t nRound = 0; nRound < 24; ++nRound)
+        {
+            /* Theta */
+            lane_t C[5];
+            for(uint32_t x = 0; x < 5; ++x)
+                C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+
+            for(uint32_t x = 0; x < 5; ++x)
+            {
+                const lane_t D = C[(x + 4) % 5] ^ ROTL_LANES(C[(x + 1) % 5], 1);
+                for(uint32_t y = 0; y < 25; y += 5)
+                    A[y + x] ^= D;
+            }
+
+            /* Rho Pi */
+            lane_t temp = A[1];
+            for(uint32_t i = 0; i < 24; ++i)
+            {
+                const lane_t next = A[KECCAK_PI_LANES[i]];
+                A[KECCAK_PI_LANES[i]] = ROTL_LANES(temp, KECCAK_ROTATIONS[i]);
+                temp = next;
+            }
+
+            /* Chi */
+            for(uint32_t y = 0; y < 25; y += 5)
+            {
+                for(uint32_t x = 0; x < 5; ++x)
+                    C[x] = A[y + x];
+
+                for(uint32_t x = 0; x < 5; ++x)
+                    A[y + x] = C[x] ^ (~C[(x + 1) % 5] & C[(x + 2) % 5]);
+            }
+
+            /* Iota */
+            A[0] ^= KECCAK_ROUND_CONSTANTS[nRound];
+        }
+    }
+
+
+    /* Load a word from each message. */
+    inline __attribute__((always_inline)) void load_lanes(lane_t& w, const uint8_t* const* pLanes, const uint64_t nOffset)
+    {
+        uint64_t n[SK512_LANES];
+        for(uint32_t i = 0; i < SK512_LANES; ++i)
+            std::memcpy(&n[i], pLanes[i] + nOffset, 8);
+
+        w = lane_t{ n[0], n[1], n[2], n[3] };
+    }
+
+
+    /* Hash four equal length messages in parallel lanes. */
+    inline __attribute__((always_inline)) void sk512_lanes(const uint8_t* const* pLanes, const uint64_t nLength, uint512_t* const* pHashes)
+    {
+        /* Start from the Skein-512-512 IV, after the configuration block. */
+        static const Skein_512_Ctxt_t CTX_IV = []
+        {
+            Skein_512_Ctxt_t ctx;
+            Skein_512_Init(&ctx, 512);
+
+            return ctx;
+        }();
+
+        lane_t X[8];
+        for(uint32_t i = 0; i < 8; ++i)
+            X[i] = lane_t{ CTX_IV.X[i], CTX_IV.X[i], CTX_IV.X[i], CTX_IV.X[i] };
+
+        /* Process the message blocks, the last one zero padded and flagged as final. */
+        const uint64_t nBlocks = std::max(uint64_t(1), (nLength + SKEIN_512_BLOCK_BYTES - 1) / SKEIN_512_BLOCK_BYTES);
+        for(uint64_t nBlock = 0; nBlock < nBlocks; ++nBlock)
+        {
+            const uint64_t nOffset = nBlock * SKEIN_512_BLOCK_BYTES;
+            const uint64_t nBytes  = std::min(uint64_t(SKEIN_512_BLOCK_BYTES), nLength - nOffset);
+
+            lane_t w[8];
+            if(nBytes == SKEIN_512_BLOCK_BYTES)
+            {
+                for(uint32_t i = 0; i < 8; ++i)
+                    load_lanes(w[i], pLanes, nOffset + i * 8);
+            }
+            else
+            {
+                /* Copy the partial block so we never read past a message. */
+                uint8_t vBlock[SK512_LANES][SKEIN_512_BLOCK_BYTES] = { };
+                const uint8_t* pBlock[SK512_LANES];
+                for(uint32_t i = 0; i < SK512_LANES; ++i)
+                {
+                    if(nBytes > 0)
+                        std::memcpy(vBlock[i], pLanes[i] + nOffset, nBytes);
+
+                    pBlock[i] = vBlock[i];
+                }
+
+                for(uint32_t i = 0; i < 8; ++i)
+                    load_lanes(w[i], pBlock, i * 8);
+            }
+
+            uint64_t t1 = SKEIN_T1_BLK_TYPE_MSG;
+            if(nBlock == 0)
+                t1 |= SKEIN_T1_FLAG_FIRST;
+            if(nBlock + 1 == nBlocks)
+                t1 |= SKEIN_T1_FLAG_FINAL;
+
+            skein512_block(X, w, nOffset + nBytes, t1);
+        }
+
+        /* Output stage, a single counter block for 512 bits. */
+        lane_t w[8] = { };
+        skein512_block(X, w, sizeof(uint64_t), SKEIN_T1_FLAG_FIRST | SKEIN_T1_BLK_TYPE_OUT_FINAL);
+
+        /* Keccak-512 over the skein hash, which fits in a single padded block of the 576 bit rate. */
+        lane_t A[25] = { };
+        for(uint32_t i = 0; i < 8; ++i)
+            A[i] = X[i];
+
+        A[8] ^= 0x06;
+        A[8] ^= 0x8000000000000000ULL;
+
+        keccak_permute(A);
+
+        /* Write out the first 512 bits of the state for each message. */
+        for(uint32_t nLane = 0; nLane < SK512_LANES; ++nLane)
+        {
+            uint64_t nWords[8];
+            for(uint32_t i = 0; i < 8; ++i)
+                nWords[i] = A[i][nLane];
+
+            std::memcpy((uint8_t*)pHashes[nLane], nWords, 64);
+        }
+    }
+
+
+#if defined(__x86_64__) || defined(__i386__)
+
+    /* Hash four messages with AVX2. */
+    __attribute__((target("avx2"))) void sk512_lanes_avx2(const uint8_t* const* pLanes, const uint64_t nLength, uint512_t* const* pHashes)
+    {
+        sk512_lanes(pLanes, nLength, pHashes);
+    }
+
+
+    /* Check once if this cpu supports AVX2. */
+    bool has_avx2()
+    {
+        static const bool fAVX2 = __builtin_cpu_supports("avx2");
+        return fAVX2;
+    }
+
+#endif
+
+
+    /* Hash four messages with the best vector instructions for this cpu. */
+    void sk512_lanes_dispatch(const uint8_t* const* pLanes, const uint64_t nLength, uint512_t* const* pHashes)
+    {
+    #if defined(__x86_64__) || defined(__i386__)
+        if(has_avx2())
+        {
+            sk512_lanes_avx2(pLanes, nLength, pHashes);
+            return;
+        }
+    #endif
+
+        sk512_lanes(pLanes, nLength, pHashes);
+    }
+
+#else
+
+    /** Without vector extensions, or on big endian, every message is hashed on its own. **/
+    const uint32_t SK512_LANES = 1;
+
+#endif
+
+
+    /* Hashes a batch of equal length messages laid out back to back. */
+    void SK512Batch(const uint8_t* pData, const uint64_t nLength, const uint32_t nCount, uint512_t* pHashes)
+    {
+        uint32_t nIndex = 0;
+
+    #if defined(SK512_VECTOR)
+        /* Hash as many messages as we can in parallel lanes. */
+        for(; nIndex + SK512_LANES <= nCount; nIndex += SK512_LANES)
+        {
+            const uint8_t* pLanes[SK512_LANES];
+            uint512_t* pOut[SK512_LANES];
+            for(uint32_t i = 0; i < SK512_LANES; ++i)
+            {
+                pLanes[i] = pData + (nIndex + i) * nLength;
+                pOut[i]   = &pHashes[nIndex + i];
+            }
+
+            sk512_lanes_dispatch(pLanes, nLength, pOut);
+        }
+    #endif
+
+        /* Hash the remaining messages one at a time. */
+        for(; nIndex < nCount; ++nIndex)
+            sk512_scalar(pData + nIndex * nLength, nLength, pHashes[nIndex]);
+    }
+
+
+    /* Hashes a batch of messages. */
+    std::vector<uint512_t> SK512Batch(const std::vector<std::vector<uint8_t>>& vData)
+    {
+        std::vector<uint512_t> vHashes(vData.size());
+
+        uint32_t nIndex = 0;
+        const uint32_t nCount = static_cast<uint32_t>(vData.size());
+        while(nIndex < nCount)
+        {
+        #if defined(SK512_VECTOR)
+            /* Hash neighbours of the same length together. */
+            bool fLanes = (nIndex + SK512_LANES <= nCount);
+            for(uint32_t i = 1; fLanes && i < SK512_LANES; ++i)
+                fLanes = (vData[nIndex + i].size() == vData[nIndex].size());
+
+            if(fLanes)
+            {
+                const uint8_t* pLanes[SK512_LANES];
+                uint512_t* pOut[SK512_LANES];
+                for(uint32_t i = 0; i < SK512_LANES; ++i)
+                {
+                    pLanes[i] = vData[nIndex + i].data();
+                    pOut[i]   = &vHashes[nIndex + i];
+                }
+
+                sk512_lanes_dispatch(pLanes, vData[nIndex].size(), pOut);
+                nIndex += SK512_LANES;
+
+                continue;
+            }
+        #endif
+
+            sk512_scalar(vData[nIndex].data(), vData[nIndex].size(), vHashes[nIndex]);
+            ++nIndex;
+        }
+
+        return vHashes;
+    }
+
+
+    /* Get the number of messages hashed together by SK512Batch. */
+    uint32_t SK512Lanes()
+    {
+        return SK512_LANES;
+    }
+}
@@ -0,0 +1,65 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLC_HASH_BATCH_H
+#define NEXUS_LLC_HASH_BATCH_H
+
+#include <LLC/types/uint1024.h>
+
+#include <cstdint>
+#include <vector>
+
+/** Namespace LLC (Lower Level Crypto) **/
+namespace LLC
+{
+
+    /** SK512Batch
+     *
+     *  Hashes a batch of equal length messages laid out back to back, giving the same result as SK512
+     *  over each message. Messages are hashed four at a time in parallel lanes, using AVX2 when the cpu
+     *  supports it, with the scalar hash for any that are left over.
+     *
+     *  @param[in] pData The messages, nCount * nLength bytes.
+     *  @param[in] nLength The length of each message in bytes.
+     *  @param[in] nCount The number of messages.
+     *  @param[out] pHashes The hashes of the messages, nCount entries.
+     *
+     **/
+    void SK512Batch(const uint8_t* pData, const uint64_t nLength, const uint32_t nCount, uint512_t* pHashes);
+
+
+    /** SK512Batch
+     *
+     *  Hashes a batch of messages, giving the same result as SK512 over each message.
+     *  Neighbouring messages of the same length share parallel lanes.
+     *
+     *  @param[in] vData The messages to hash.
+     *
+     *  @return The hashes of the messages, in the same order.
+     *
+     **/
+    std::vector<uint512_t> SK512Batch(const std::vector<std::vector<uint8_t>>& vData);
+
+
+    /** SK512Lanes
+     *
+     *  Get the number of messages hashed together by SK512Batch on this cpu, 1 when there is no
+     *  vector support and every message is hashed on its own.
+     *
+     **/
+    uint32_t SK512Lanes();
+
+}
+
+#endif
@@ -0,0 +1,157 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLC_HASH_WRITER_H
+#define NEXUS_LLC_HASH_WRITER_H
+
+#include <LLC/types/uint1024.h>
+#include <LLC/hash/SK/skein.h>
+#include <LLC/hash/SK/KeccakHash.h>
+
+#include <Util/templates/serialize.h>
+
+#include <cstdint>
+
+/** Namespace LLC (Lower Level Crypto) **/
+namespace LLC
+{
+
+    /** SKHashWriter
+     *
+     *  Serialization stream that feeds everything written to it straight into a Skein context,
+     *  finishing with Keccak the same as SK256, SK512 and SK1024 over the serialized bytes.
+     *  Objects are hashed in a single pass without buffering their serialization.
+     *
+     **/
+    template<uint32_t BITS>
+    class SKHashWriter
+    {
+        static_assert(BITS == 256 || BITS == 512 || BITS == 1024, "SKHashWriter only supports 256, 512 and 1024 bits");
+
+
+        /** The skein context for our width. **/
+        union
+        {
+            Skein_256_Ctxt_t ctx256;
+            Skein_512_Ctxt_t ctx512;
+            Skein1024_Ctxt_t ctx1024;
+        };
+
+
+        /** The serialization type. **/
+        uint32_t nSerType;
+
+
+        /** The serialization version. **/
+        uint32_t nSerVersion;
+
+
+    public:
+
+        /** Constructor
+         *
+         *  @param[in] nSerTypeIn The serialize type.
+         *  @param[in] nSerVersionIn The serialize version.
+         *
+         **/
+        SKHashWriter(const uint32_t nSerTypeIn, const uint32_t nSerVersionIn)
+        : nSerType    (nSerTypeIn)
+        , nSerVersion (nSerVersionIn)
+        {
+            if(BITS == 256)
+                Skein_256_Init(&ctx256, 256);
+            else if(BITS == 512)
+                Skein_512_Init(&ctx512, 512);
+            else
+                Skein1024_Init(&ctx1024, 1024);
+        }
+
+
+        /** write
+         *
+         *  Hashes the given bytes.
+         *
+         *  @param[in] pch The pointer to beginning of memory to hash.
+         *  @param[in] nSize The total number of bytes to hash.
+         *
+         **/
+        SKHashWriter& write(const char* pch, const uint64_t nSize)
+        {
+            /* Skip empty writes, pch may be null. */
+            if(nSize == 0)
+                return *this;
+
+            if(BITS == 256)
+                Skein_256_Update(&ctx256, (const uint8_t*)pch, nSize);
+            else if(BITS == 512)
+                Skein_512_Update(&ctx512, (const uint8_t*)pch, nSize);
+            else
+                Skein1024_Update(&ctx1024, (const uint8_t*)pch, nSize);
+
+            return *this;
+        }
+
+
+        /** GetHash
+         *
+         *  Finishes the hash of everything written. The writer can't be used after this.
+         *
+         **/
+        base_uint<BITS> GetHash()
+        {
+            /* Finish the skein pass. */
+            base_uint<BITS> hashSkein;
+            if(BITS == 256)
+                Skein_256_Final(&ctx256, (uint8_t *)&hashSkein);
+            else if(BITS == 512)
+                Skein_512_Final(&ctx512, (uint8_t *)&hashSkein);
+            else
+                Skein1024_Final(&ctx1024, (uint8_t *)&hashSkein);
+
+            /* Keccak over the skein hash. */
+            Keccak_HashInstance ctxKeccak;
+            if(BITS == 256)
+                Keccak_HashInitialize_SHA3_256(&ctxKeccak);
+            else if(BITS == 512)
+                Keccak_HashInitialize_SHA3_512(&ctxKeccak);
+            else
+                Keccak_HashInitialize(&ctxKeccak, 576, 1024, 1024, 0x05);
+
+            base_uint<BITS> hashKeccak;
+            Keccak_HashUpdate(&ctxKeccak, (uint8_t *)&hashSkein, BITS);
+            Keccak_HashFinal(&ctxKeccak, (uint8_t *)&hashKeccak);
+
+            return hashKeccak;
+        }
+
+
+        /** Operator Overload <<
+         *
+         *  Serializes an object into the hash.
+         *
+         *  @param[in] obj The object to serialize.
+         *
+         **/
+        template<typename Type>
+        SKHashWriter& operator<<(const Type& obj)
+        {
+            /* Serialize to the stream. */
+            ::Serialize(*this, obj, nSerType, nSerVersion);
+
+            return (*this);
+        }
+    };
+}
+
+#endif
@@ -0,0 +1,208 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLC_INCLUDE_ARGON2_POOL_H
+#define NEXUS_LLC_INCLUDE_ARGON2_POOL_H
+
+#include <LLC/hash/argon2.h>
+
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace LLC
+{
+
+    /** Argon2Pool
+     *
+     *  Key derivation service for memory hard argon2 hashing. A fixed number of memory arenas
+     *  are faulted in and locked once, then handed to argon2 through its custom allocation
+     *  hooks, so repeated logins and unlocks don't map and zero fresh memory on every call.
+     *  The number of arenas caps the concurrent derivations, with other callers waiting in turn.
+     *
+     **/
+    class Argon2Pool
+    {
+    public:
+
+        /** Stats
+         *
+         *  Counters for the key derivations, all times in microseconds.
+         *
+         **/
+        struct Stats
+        {
+            /** Total derivations completed. **/
+            uint64_t nDerived;
+
+
+            /** Total derivations too large for an arena that used the heap instead. **/
+            uint64_t nOversized;
+
+
+            /** Total time spent waiting for an arena. **/
+            uint64_t nWaitTime;
+
+
+            /** Total time spent hashing. **/
+            uint64_t nHashTime;
+
+
+            /** Current callers waiting for an arena. **/
+            uint32_t nWaiting;
+
+
+            /** Most callers that have waited at once. **/
+            uint32_t nPeakWaiting;
+
+
+            /** Total arenas created. **/
+            uint32_t nArenas;
+
+
+            /** Total arenas that were locked into memory. **/
+            uint32_t nLocked;
+
+
+            /** Default Constructor. **/
+            Stats()
+            : nDerived     (0)
+            , nOversized   (0)
+            , nWaitTime    (0)
+            , nHashTime    (0)
+            , nWaiting     (0)
+            , nPeakWaiting (0)
+            , nArenas      (0)
+            , nLocked      (0)
+            {
+            }
+        };
+
+
+    private:
+
+        /** Arena
+         *
+         *  A single block of memory big enough for one derivation.
+         *
+         **/
+        struct Arena
+        {
+            /** The arena memory. **/
+            uint8_t* pMemory;
+
+
+            /** The size of the arena in bytes. **/
+            size_t nSize;
+
+
+            /** Flag to determine if the arena was locked into memory. **/
+            bool fLocked;
+        };
+
+
+        /** Mutex to protect the arenas and stats. **/
+        mutable std::mutex POOL_MUTEX;
+
+
+        /** Condition to wake callers waiting for an arena. **/
+        std::condition_variable CONDITION;
+
+
+        /** All arenas owned by this pool. **/
+        std::vector<Arena*> vArenas;
+
+
+        /** Arenas not currently in use. **/
+        std::vector<Arena*> vFree;
+
+
+        /** The maximum arenas to create. **/
+        const uint32_t nMaxArenas;
+
+
+        /** The size of each arena in bytes. **/
+        const size_t nArenaSize;
+
+
+        /** The derivation counters. **/
+        Stats stats;
+
+
+    public:
+
+        /** Constructor
+         *
+         *  @param[in] nMaxArenasIn The maximum arenas, and so concurrent derivations.
+         *  @param[in] nArenaSizeIn The size of each arena in bytes.
+         *
+         **/
+        Argon2Pool(const uint32_t nMaxArenasIn, const size_t nArenaSizeIn);
+
+
+        /** Destructor **/
+        ~Argon2Pool();
+
+
+        /** GetInstance
+         *
+         *  Get the global pool, sized from -argon2arenas and the largest argon2 memory cost.
+         *
+         **/
+        static Argon2Pool& GetInstance();
+
+
+        /** Hash
+         *
+         *  Run an argon2id computation using one of our arenas. Waits for an arena if all are
+         *  in use. Any allocation callbacks already set on the context are replaced.
+         *
+         *  @param[in] context The argon2 context to compute.
+         *
+         *  @return The argon2 return code.
+         *
+         **/
+        int32_t Hash(argon2_context& context);
+
+
+        /** GetStats
+         *
+         *  Get a copy of the derivation counters.
+         *
+         **/
+        Stats GetStats() const;
+
+
+    private:
+
+        /** acquire
+         *
+         *  Get a free arena, creating one if under our limit, waiting otherwise.
+         *
+         **/
+        Arena* acquire();
+
+
+        /** release
+         *
+         *  Return an arena to the pool and wake the next waiting caller.
+         *
+         **/
+        void release(Arena* pArena);
+
+    };
+}
+
+#endif
@@ -212,6 +212,35 @@ namespace LLC
         bool Verify(const std::vector<uint8_t>& vchData, const std::vector<uint8_t>& vchSig) const;
 
 
+        /** ExpandPubKey
+         *
+         *  Decode a public key and convert it to NTT form, so that signatures can be verified
+         *  against it without decoding it again.
+         *
+         *  @param[in] vchPubKey The public key to expand.
+         *  @param[out] vchExpanded The expanded public key.
+         *
+         *  @return True if the public key was expanded.
+         *
+         **/
+        static bool ExpandPubKey(const std::vector<uint8_t>& vchPubKey, std::vector<uint8_t>& vchExpanded);
+
+
+        /** VerifyExpanded
+         *
+         *  Signature Verification Function against an expanded public key.
+         *
+         *  @param[in] vchExpanded The public key expanded by ExpandPubKey.
+         *  @param[in] vchData The input data to sign in bytes.
+         *  @param[in] vchSig The signature to check.
+         *
+         *  @return True if the Signature was Verified as Valid
+         *
+         **/
+        static bool VerifyExpanded(const std::vector<uint8_t>& vchExpanded,
+                                   const std::vector<uint8_t>& vchData, const std::vector<uint8_t>& vchSig);
+
+
         /** IsValid
          *
          *  Check if a Key is valid based on a few parameters.
@@ -19,6 +19,9 @@ ________________________________________________________________________________
 #include <vector>
 #include <cstdint>
 #include <cmath>
+#include <cstring>
+#include <algorithm>
+#include <functional>
 
 
 //forward declarations
@@ -519,6 +522,30 @@ public:
     uint32_t bits() const;
 
 
+    /** CompareTo
+     *
+     *  Compares against another base_uint of the same width.
+     *
+     *  @param[in] n The value to compare against.
+     *
+     *  @return Returns -1 if less than n, 0 if equal, 1 if greater than n.
+     *
+     **/
+    int32_t CompareTo(const base_uint& n) const;
+
+
+protected:
+
+    /** words
+     *
+     *  Returns the number of significant 32-bit words, ignoring leading zero words.
+     *
+     **/
+    uint32_t words() const;
+
+
+public:
+
     /* Needed for specialized copy and assignment constructors. */
     friend class TAO::Register::Address;
     friend class TAO::Ledger::Genesis;
@@ -838,8 +865,20 @@ namespace std
     {
         size_t operator()(const base_uint<BITS>& val) const
         {
-            /* Base the hash function on the string representation, which is the number converted to hex */
-            return hash<std::string>()(val.ToString());
+            /* Fold the words together, the values we key on are already uniformly distributed hashes. */
+            const uint8_t* pBegin = val.begin();
+
+            uint64_t nHash = 0;
+            for(uint32_t nPos = 0; nPos < BITS / 8; nPos += 8)
+            {
+                /* The last word is only 32 bits for widths that aren't a multiple of 64. */
+                uint64_t nWord = 0;
+                std::memcpy(&nWord, pBegin + nPos, std::min(8u, BITS / 8 - nPos));
+
+                nHash = (nHash ^ nWord) * 0x9e3779b97f4a7c15;
+            }
+
+            return static_cast<size_t>(nHash ^ (nHash >> 32));
         }
     };
 }
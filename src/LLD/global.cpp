@@ -15,6 +15,11 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/include/enum.h> //for internal flags
 
+#include <Util/include/runtime.h>
+
+#include <thread>
+#include <vector>
+
 namespace LLD
 {
     /* The LLD global instance pointers. */
@@ -33,41 +38,112 @@ namespace LLD
     {
         debug::log(0, FUNCTION, "Initializing LLD");
 
-        /* Create the contract database instance. */
-        Contract = new ContractDB(
-                        FLAGS::CREATE | FLAGS::FORCE);
+        /* Get our cache sizes. */
+        uint32_t nRegisterCacheSize = config::GetArg("-registercache", 2);
+        uint32_t nLedgerCacheSize   = config::GetArg("-ledgercache", 2);
+        uint32_t nLegacyCacheSize   = config::GetArg("-legacycache", 1);
+
+        /* The time in milliseconds each database took to open. */
+        uint32_t nContractTime = 0, nRegisterTime = 0, nLedgerTime = 0, nLegacyTime = 0, nTrustTime = 0, nLocalTime = 0;
+
+        /* Open the databases in parallel, each loads its own index and sector files so startup is bound by the slowest. */
+        std::vector<std::thread> vThreads;
 
         /* Create the contract database instance. */
-        uint32_t nRegisterCacheSize = config::GetArg("-registercache", 2);
-        Register = new RegisterDB(
-                        FLAGS::CREATE | FLAGS::FORCE,
-                        77773, 
-                        nRegisterCacheSize * 1024 * 1024);
+        vThreads.push_back(std::thread([&]()
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            Contract = new ContractDB(
+                            FLAGS::CREATE | FLAGS::FORCE);
+
+            nContractTime = timer.ElapsedMilliseconds();
+        }));
+
+        /* Create the register database instance. */
+        vThreads.push_back(std::thread([&]()
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            Register = new RegisterDB(
+                            FLAGS::CREATE | FLAGS::FORCE,
+                            77773,
+                            nRegisterCacheSize * 1024 * 1024);
+
+            nRegisterTime = timer.ElapsedMilliseconds();
+        }));
 
         /* Create the ledger database instance. */
-        uint32_t nLedgerCacheSize = config::GetArg("-ledgercache", 2);
-        Ledger    = new LedgerDB(
-                        FLAGS::CREATE | FLAGS::FORCE,
-                        256 * 256 * 64,
-                        nLedgerCacheSize * 1024 * 1024);
+        vThreads.push_back(std::thread([&]()
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            Ledger    = new LedgerDB(
+                            FLAGS::CREATE | FLAGS::FORCE,
+                            256 * 256 * 64,
+                            nLedgerCacheSize * 1024 * 1024);
+
+            nLedgerTime = timer.ElapsedMilliseconds();
+        }));
 
         /* Create the legacy database instance. */
-        uint32_t nLegacyCacheSize = config::GetArg("-legacycache", 1);
-        Legacy = new LegacyDB(
-                        FLAGS::CREATE | FLAGS::FORCE,
-                        256 * 256 * 64,
-                        nLegacyCacheSize * 1024 * 1024);
+        vThreads.push_back(std::thread([&]()
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            Legacy = new LegacyDB(
+                            FLAGS::CREATE | FLAGS::FORCE,
+                            256 * 256 * 64,
+                            nLegacyCacheSize * 1024 * 1024);
+
+            nLegacyTime = timer.ElapsedMilliseconds();
+        }));
 
         /* Create the trust database instance. */
-        Trust  = new TrustDB(
-                        FLAGS::CREATE | FLAGS::FORCE);
+        vThreads.push_back(std::thread([&]()
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            Trust  = new TrustDB(
+                            FLAGS::CREATE | FLAGS::FORCE);
+
+            nTrustTime = timer.ElapsedMilliseconds();
+        }));
 
         /* Create the local database instance. */
-        Local    = new LocalDB(
-                        FLAGS::CREATE | FLAGS::FORCE);
+        vThreads.push_back(std::thread([&]()
+        {
+            runtime::timer timer;
+            timer.Start();
+
+            Local    = new LocalDB(
+                            FLAGS::CREATE | FLAGS::FORCE);
+
+            nLocalTime = timer.ElapsedMilliseconds();
+        }));
+
+        /* Wait for all of the databases to finish opening. */
+        for(auto& thread : vThreads)
+            thread.join();
+
+        debug::log(0, FUNCTION, "Opened databases in ",
+            "contract ", nContractTime, "ms, ",
+            "register ", nRegisterTime, "ms, ",
+            "ledger ",   nLedgerTime,   "ms, ",
+            "legacy ",   nLegacyTime,   "ms, ",
+            "trust ",    nTrustTime,    "ms, ",
+            "local ",    nLocalTime,    "ms");
 
         /* Handle database recovery mode. */
         TxnRecovery();
+
+        /* Build the register aggregates if they haven't been indexed. */
+        Register->IndexMetrics();
     }
 
 
@@ -181,25 +181,18 @@ namespace LLD
         /* Read the hashmap indexes. */
         else
         {
-            /* Build a vector to read the disk index. */
-            std::vector<uint8_t> vIndex(HASHMAP_TOTAL_BUCKETS * 2, 0);
-
-            /* Read the disk index bytes. */
+            /* Read the disk index straight into the memory index, it is stored in the same layout. */
             std::fstream stream(index, std::ios::in | std::ios::binary);
-            stream.read((char*)&vIndex[0], vIndex.size());
+            stream.read((char*)&hashmap[0], HASHMAP_TOTAL_BUCKETS * 2);
             stream.close();
 
-            /* Deserialize the values into memory index. */
+            /* Count the keys for our debug output. */
             uint32_t nTotalKeys = 0;
             for(uint32_t nBucket = 0; nBucket < HASHMAP_TOTAL_BUCKETS; ++nBucket)
-            {
-                std::copy((uint8_t *)&vIndex[nBucket * 2], (uint8_t *)&vIndex[nBucket * 2] + 2, (uint8_t *)&hashmap[nBucket]);
-
                 nTotalKeys += hashmap[nBucket];
-            }
 
             /* Debug output showing loading of disk index. */
-            debug::log(0, FUNCTION, "Loaded Disk Index of ", vIndex.size(), " bytes and ", nTotalKeys, " keys");
+            debug::log(0, FUNCTION, "Loaded Disk Index of ", HASHMAP_TOTAL_BUCKETS * 2, " bytes and ", nTotalKeys, " keys");
         }
 
         /* Build the first hashmap index file if it doesn't exist. */
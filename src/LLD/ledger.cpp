@@ -19,6 +19,7 @@ ________________________________________________________________________________
 #include <TAO/Register/include/constants.h>
 
 #include <TAO/Ledger/types/transaction.h>
+#include <TAO/Ledger/types/transaction_view.h>
 #include <TAO/Ledger/include/chainstate.h>
 #include <TAO/Ledger/include/constants.h>
 #include <TAO/Ledger/types/state.h>
@@ -93,14 +94,25 @@ namespace LLD
         /* Check for Tritium transaction. */
         if(hashTx.GetType() == TAO::Ledger::TRITIUM)
         {
-            /* Get the transaction. */
-            TAO::Ledger::Transaction tx;
-            if(!ReadTx(hashTx, tx, nFlags))
+            /* Special check for memory pool. */
+            if(nFlags == TAO::Ledger::FLAGS::MEMPOOL || nFlags == TAO::Ledger::FLAGS::MINER)
+            {
+                /* Get the transaction. */
+                TAO::Ledger::Transaction tx;
+                if(TAO::Ledger::mempool.Get(hashTx, tx))
+                {
+                    /* Get const reference for read-only access. */
+                    const TAO::Ledger::Transaction& ref = tx;
+                    return ref[nContract];
+                }
+            }
+
+            /* Read a view so only the requested contract is decoded. */
+            TAO::Ledger::TransactionView view(hashTx);
+            if(!Read(hashTx, view))
                 throw debug::exception(FUNCTION, "failed to read contract");
 
-            /* Get const reference for read-only access. */
-            const TAO::Ledger::Transaction& ref = tx;
-            return ref[nContract];
+            return view[nContract];
         }
 
         /* Check for Legacy transaction. */
@@ -14,6 +14,7 @@ ________________________________________________________________________________
 #include <LLD/types/register.h>
 
 #include <TAO/Register/include/enum.h>
+#include <TAO/Register/types/object.h>
 
 namespace LLD
 {
@@ -29,6 +30,8 @@ namespace LLD
     , pMemory(nullptr)
     , pMiner(nullptr)
     , pCommit(new RegisterTransaction())
+    , METRICS_MUTEX()
+    , fMetrics(false)
     {
     }
 
@@ -58,6 +61,9 @@ namespace LLD
         /* Memory mode for pre-database commits. */
         if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
         {
+            /* Copy the state before taking the lock. */
+            std::shared_ptr<const TAO::Register::State> ptr = std::make_shared<const TAO::Register::State>(state);
+
             LOCK(MEMORY_MUTEX);
 
             /* Check for memory mode. */
@@ -65,23 +71,26 @@ namespace LLD
             {
                 /* Check erase queue. */
                 pMemory->setErase.erase(hashRegister);
-                pMemory->mapStates[hashRegister] = state;
+                pMemory->mapStates[hashRegister] = std::move(ptr);
 
                 return true;
             }
 
             /* Otherwise commit like normal. */
-            pCommit->mapStates[hashRegister] = state;
+            pCommit->mapStates[hashRegister] = std::move(ptr);
 
             return true;
         }
         else if(nFlags == TAO::Ledger::FLAGS::MINER)
         {
+            /* Copy the state before taking the lock. */
+            std::shared_ptr<const TAO::Register::State> ptr = std::make_shared<const TAO::Register::State>(state);
+
             LOCK(MEMORY_MUTEX);
 
             /* Check for memory mode. */
             if(pMiner)
-                pMiner->mapStates[hashRegister] = state;
+                pMiner->mapStates[hashRegister] = std::move(ptr);
 
             return true;
         }
@@ -90,11 +99,11 @@ namespace LLD
             LOCK(MEMORY_MUTEX);
 
             /* Remove the memory state if writing the disk state. */
-            if(pCommit->mapStates.count(hashRegister))
+            auto it = pCommit->mapStates.find(hashRegister);
+            if(it != pCommit->mapStates.end())
             {
                 /* Check for most recent memory state, and remove if writing it. */
-                const TAO::Register::State& stateCheck = pCommit->mapStates[hashRegister];
-                if(stateCheck == state || nFlags == TAO::Ledger::FLAGS::ERASE)
+                if(nFlags == TAO::Ledger::FLAGS::ERASE || *it->second == state)
                 {
                     /* Erase if transaction. */
                     if(pMemory)
@@ -160,49 +169,33 @@ namespace LLD
                 strType = "NONE";
         }
 
+        /* Write the state without aggregates until they are indexed. */
+        if(!fMetrics.load())
+            return Write(std::make_pair(std::string("state"), hashRegister), state, strType);
+
+        LOCK(METRICS_MUTEX);
+
+        /* Get the previous state to remove from our aggregates. */
+        TAO::Register::State statePrev;
+        const bool fPrev = Read(std::make_pair(std::string("state"), hashRegister), statePrev);
+
         /* Write the state to the register database */
-        return Write(std::make_pair(std::string("state"), hashRegister), state, strType);
+        if(!Write(std::make_pair(std::string("state"), hashRegister), state, strType))
+            return false;
+
+        return update_metrics(hashRegister, fPrev ? &statePrev : nullptr, &state);
     }
 
 
     /* Read a state register from the register database. */
     bool RegisterDB::ReadState(const uint256_t& hashRegister, TAO::Register::State& state, const uint8_t nFlags)
     {
-        /* Memory mode for pre-database commits. */
-        if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
-        {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check for a memory transaction first */
-            if(pMemory && pMemory->mapStates.count(hashRegister))
-            {
-                /* Get the state from temporary transaction. */
-                state = pMemory->mapStates[hashRegister];
-
-                return true;
-            }
-
-            /* Check for state in memory map. */
-            if(pCommit->mapStates.count(hashRegister))
-            {
-                /* Get the state from commited memory. */
-                state = pCommit->mapStates[hashRegister];
-
-                return true;
-            }
-        }
-        else if(nFlags == TAO::Ledger::FLAGS::MINER)
+        /* Check the memory layers, copying the state outside of the memory lock. */
+        const std::shared_ptr<const TAO::Register::State> ptr = read_memory(hashRegister, nFlags);
+        if(ptr)
         {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check for a memory transaction first */
-            if(pMiner && pMiner->mapStates.count(hashRegister))
-            {
-                /* Get the state from temporary transaction. */
-                state = pMiner->mapStates[hashRegister];
-
-                return true;
-            }
+            state = *ptr;
+            return true;
         }
 
         return Read(std::make_pair(std::string("state"), hashRegister), state);
@@ -253,7 +246,21 @@ namespace LLD
                 return true;
         }
 
-        return Erase(std::make_pair(std::string("state"), hashRegister));
+        /* Erase the state without aggregates until they are indexed. */
+        if(!fMetrics.load())
+            return Erase(std::make_pair(std::string("state"), hashRegister));
+
+        LOCK(METRICS_MUTEX);
+
+        /* Get the previous state to remove from our aggregates. */
+        TAO::Register::State statePrev;
+        const bool fPrev = Read(std::make_pair(std::string("state"), hashRegister), statePrev);
+
+        /* Erase the state from the register database. */
+        if(!Erase(std::make_pair(std::string("state"), hashRegister)))
+            return false;
+
+        return update_metrics(hashRegister, fPrev ? &statePrev : nullptr, nullptr);
     }
 
 
@@ -298,41 +305,12 @@ namespace LLD
         uint256_t hashRegister =
             TAO::Register::Address(std::string("trust"), hashGenesis, TAO::Register::Address::TRUST);
 
-        /* Memory mode for pre-database commits. */
-        if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
+        /* Check the memory layers, copying the state outside of the memory lock. */
+        const std::shared_ptr<const TAO::Register::State> ptr = read_memory(hashRegister, nFlags);
+        if(ptr)
         {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check for a memory transaction first */
-            if(pMemory && pMemory->mapStates.count(hashRegister))
-            {
-                /* Get the state from temporary transaction. */
-                state = pMemory->mapStates[hashRegister];
-
-                return true;
-            }
-
-            /* Check for state in memory map. */
-            if(pCommit->mapStates.count(hashRegister))
-            {
-                /* Get the state from commited memory. */
-                state = pCommit->mapStates[hashRegister];
-
-                return true;
-            }
-        }
-        else if(nFlags == TAO::Ledger::FLAGS::MINER)
-        {
-            LOCK(MEMORY_MUTEX);
-
-            /* Check for a memory transaction first */
-            if(pMiner && pMiner->mapStates.count(hashRegister))
-            {
-                /* Get the state from temporary transaction. */
-                state = pMiner->mapStates[hashRegister];
-
-                return true;
-            }
+            state = *ptr;
+            return true;
         }
 
         return Read(std::make_pair(std::string("genesis"), hashGenesis), state);
@@ -378,6 +356,130 @@ namespace LLD
         return Exists(std::make_pair(std::string("state"), hashRegister));
     }
 
+
+    /* Read the chain-wide aggregates over all registers on disk. */
+    bool RegisterDB::ReadMetrics(TAO::Register::Metrics& metrics)
+    {
+        /* Check that aggregates have been indexed. */
+        if(!fMetrics.load())
+            return false;
+
+        return Read(std::string("metrics"), metrics);
+    }
+
+
+    /* Build the register aggregates with a full scan if they don't exist yet. */
+    bool RegisterDB::IndexMetrics()
+    {
+        LOCK(METRICS_MUTEX);
+
+        /* Check for existing aggregates. */
+        if(Exists(std::string("metrics")))
+        {
+            fMetrics.store(true);
+            return true;
+        }
+
+        debug::log(0, FUNCTION, "Indexing register metrics...");
+
+        /* The register types that are keyed on disk. */
+        const std::vector< std::pair<std::string, uint8_t> > vTypes =
+        {
+            {"account",   TAO::Register::Address::ACCOUNT},
+            {"append",    TAO::Register::Address::APPEND},
+            {"crypto",    TAO::Register::Address::CRYPTO},
+            {"name",      TAO::Register::Address::NAME},
+            {"namespace", TAO::Register::Address::NAMESPACE},
+            {"object",    TAO::Register::Address::OBJECT},
+            {"raw",       TAO::Register::Address::RAW},
+            {"readonly",  TAO::Register::Address::READONLY},
+            {"token",     TAO::Register::Address::TOKEN},
+            {"trust",     TAO::Register::Address::TRUST}
+        };
+
+        /* Scan each type once. */
+        TAO::Register::Metrics metrics;
+        for(const auto& type : vTypes)
+        {
+            /* Batch read all registers of this type. */
+            std::vector<TAO::Register::State> vStates;
+            BatchRead(type.first, vStates, -1);
+
+            /* Add each one to our aggregates. */
+            for(const auto& state : vStates)
+                metrics.Add(type.second, state);
+        }
+
+        /* Write our new aggregates. */
+        if(!Write(std::string("metrics"), metrics))
+            return debug::error(FUNCTION, "failed to write metrics");
+
+        debug::log(0, FUNCTION, "Indexed ", metrics.Registers(), " registers");
+
+        fMetrics.store(true);
+        return true;
+    }
+
+
+    /* Get a register's newest state from the memory layers for the given flags. */
+    std::shared_ptr<const TAO::Register::State> RegisterDB::read_memory(const uint256_t& hashRegister, const uint8_t nFlags)
+    {
+        /* Memory mode for pre-database commits. */
+        if(nFlags == TAO::Ledger::FLAGS::MEMPOOL)
+        {
+            LOCK(MEMORY_MUTEX);
+
+            /* Check for a memory transaction first */
+            if(pMemory)
+            {
+                auto it = pMemory->mapStates.find(hashRegister);
+                if(it != pMemory->mapStates.end())
+                    return it->second;
+            }
+
+            /* Check for state in memory map. */
+            auto it = pCommit->mapStates.find(hashRegister);
+            if(it != pCommit->mapStates.end())
+                return it->second;
+        }
+        else if(nFlags == TAO::Ledger::FLAGS::MINER)
+        {
+            LOCK(MEMORY_MUTEX);
+
+            /* Check for a memory transaction first */
+            if(pMiner)
+            {
+                auto it = pMiner->mapStates.find(hashRegister);
+                if(it != pMiner->mapStates.end())
+                    return it->second;
+            }
+        }
+
+        return nullptr;
+    }
+
+
+    /* Update the register aggregates for a state being replaced on disk. */
+    bool RegisterDB::update_metrics(const uint256_t& hashRegister,
+        const TAO::Register::State* pstatePrev, const TAO::Register::State* pstateNext)
+    {
+        /* Read the current aggregates. */
+        TAO::Register::Metrics metrics;
+        if(!Read(std::string("metrics"), metrics))
+            return debug::error(FUNCTION, "failed to read metrics");
+
+        /* Replace the contribution of the previous state. */
+        const uint8_t nAddress = hashRegister.GetType();
+        if(pstatePrev)
+            metrics.Remove(nAddress, *pstatePrev);
+
+        if(pstateNext)
+            metrics.Add(nAddress, *pstateNext);
+
+        return Write(std::string("metrics"), metrics);
+    }
+
+
     /* Begin a memory transaction following ACID properties. */
     void RegisterDB::MemoryBegin(const uint8_t nFlags)
     {
@@ -436,9 +538,9 @@ namespace LLD
         /* Abort the current memory mode. */
         if(pMemory)
         {
-            /* Loop through all new states and apply to commit data. */
-            for(const auto& state : pMemory->mapStates)
-                pCommit->mapStates[state.first] = state.second;
+            /* Loop through all new states and apply to commit data, sharing rather than copying them. */
+            for(auto& state : pMemory->mapStates)
+                pCommit->mapStates[state.first] = std::move(state.second);
 
             /* Loop through values to erase. */
             for(const auto& erase : pMemory->setErase)
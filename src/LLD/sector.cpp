@@ -112,36 +112,39 @@ namespace LLD
         if(nFlags & FLAGS::CREATE && !filesystem::exists(strBaseLocation) && filesystem::create_directories(strBaseLocation))
             debug::log(0, FUNCTION, "Generated Path ", strBaseLocation);
 
-        /* Find the most recent append file. */
-        while(true)
+        /* Find the most recent append file. Files are contiguous, so gallop forward then binary search for the last one. */
+        if(filesystem::exists(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), 0u)))
         {
-
-            /* TODO: Make a worker or thread to check sizes of files and automatically create new file.
-                Keep independent of reads and writes for efficiency. */
-            std::fstream stream(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nCurrentFile), std::ios::in | std::ios::binary);
-            if(!stream)
+            /* Double until we pass the end, the last file is in [nLower, nUpper). */
+            uint32_t nLower = 0, nUpper = 1;
+            while(filesystem::exists(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nUpper)))
             {
+                nLower  = nUpper;
+                nUpper *= 2;
+            }
 
-                /* Assign the Current Size and File. */
-                if(nCurrentFile > 0)
-                    --nCurrentFile;
+            /* Narrow down to the last file that exists. */
+            while(nUpper - nLower > 1)
+            {
+                const uint32_t nMiddle = nLower + (nUpper - nLower) / 2;
+                if(filesystem::exists(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nMiddle)))
+                    nLower = nMiddle;
                 else
-                {
-                    /* Create a new file if it doesn't exist. */
-                    std::ofstream cStream(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nCurrentFile), std::ios::binary | std::ios::out | std::ios::trunc);
-                    cStream.close();
-                }
-
-                break;
+                    nUpper = nMiddle;
             }
+            nCurrentFile = nLower;
 
-            /* Get the Binary Size. */
+            /* Get the Binary Size of only the append file. */
+            std::fstream stream(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nCurrentFile), std::ios::in | std::ios::binary);
             stream.seekg(0, std::ios::end);
             nCurrentFileSize = static_cast<uint32_t>(stream.tellg());
             stream.close();
-
-            /* Increment the Current File */
-            ++nCurrentFile;
+        }
+        else
+        {
+            /* Create a new file if it doesn't exist. */
+            std::ofstream cStream(debug::safe_printstr(strBaseLocation, "_block.", std::setfill('0'), std::setw(5), nCurrentFile), std::ios::binary | std::ios::out | std::ios::trunc);
+            cStream.close();
         }
 
         pTransaction = nullptr;
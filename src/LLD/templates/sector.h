@@ -192,7 +192,7 @@ namespace LLD
         {
             /* Serialize Key into Bytes. */
             DataStream ssKey(SER_LLD, DATABASE_VERSION);
-            ssKey << key;
+            ssKey.Encode(key);
 
             /* Get reference of key. */
             const std::vector<uint8_t>& vKey = ssKey.Bytes();
@@ -248,7 +248,7 @@ namespace LLD
 
             /* Serialize Key into Bytes. */
             DataStream ssKey(SER_LLD, DATABASE_VERSION);
-            ssKey << key;
+            ssKey.Encode(key);
 
             /* Remove the item from the cache pool. */
             cachePool->Remove(ssKey.Bytes());
@@ -310,7 +310,7 @@ namespace LLD
         {
             /* Serialize Key into Bytes. */
             DataStream ssKey(SER_LLD, DATABASE_VERSION);
-            ssKey << key;
+            ssKey.Encode(key);
 
             /* Get the key. */
             SectorKey cKey;
@@ -455,7 +455,7 @@ namespace LLD
         {
             /* Serialize Key into Bytes. */
             DataStream ssKey(SER_LLD, DATABASE_VERSION);
-            ssKey << key;
+            ssKey.Encode(key);
 
             /* Get the Data from Sector Database. */
             std::vector<uint8_t> vData;
@@ -530,11 +530,11 @@ namespace LLD
         {
             /* Serialize Key into Bytes. */
             DataStream ssKey(SER_LLD, DATABASE_VERSION);
-            ssKey << key;
+            ssKey.Encode(key);
 
             /* Serialize the index into bytes. */
             DataStream ssIndex(SER_LLD, DATABASE_VERSION);
-            ssIndex << index;
+            ssIndex.Encode(index);
 
             /* Get reference of key and index. */
             const std::vector<uint8_t>& vKey   = ssKey.Bytes();
@@ -590,7 +590,7 @@ namespace LLD
 
             /* Serialize Key into Bytes. */
             DataStream ssKey(SER_LLD, DATABASE_VERSION);
-            ssKey << key;
+            ssKey.Encode(key);
 
             /* Get reference of key. */
             const std::vector<uint8_t>& vKey = ssKey.Bytes();
@@ -638,12 +638,11 @@ namespace LLD
 
             /* Serialize the Key. */
             DataStream ssKey(SER_LLD, DATABASE_VERSION);
-            ssKey << key;
+            ssKey.Encode(key);
 
             /* Serialize the Value */
             DataStream ssData(SER_LLD, DATABASE_VERSION);
-            ssData << strType;
-            ssData << value;
+            ssData.Encode(strType, value);
 
             /* Get reference of key and data. */
             const std::vector<uint8_t>& vKey  = ssKey.Bytes();
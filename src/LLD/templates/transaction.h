@@ -17,14 +17,32 @@ ________________________________________________________________________________
 
 #include <LLC/types/uint1024.h>
 
+#include <LLD/hash/xxh3.h>
+
 #include <Util/templates/datastream.h>
 
 #include <cstdint>
-#include <map>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
 namespace LLD
 {
+
+    /** KeyHash
+     *
+     *  Hash function for binary keys in unordered containers.
+     *
+     **/
+    struct KeyHash
+    {
+        size_t operator()(const std::vector<uint8_t>& vKey) const
+        {
+            return static_cast<size_t>(XXH64(vKey.data(), vKey.size(), 0));
+        }
+    };
+
+
     /** SectorTransaction
      *
      *  Transaction Class to hold the data that is stored in Binary.
@@ -65,16 +83,16 @@ namespace LLD
     public:
 
         /** New Data to be Added. **/
-        std::map< std::vector<uint8_t>, std::vector<uint8_t> > mapTransactions;
+        std::unordered_map< std::vector<uint8_t>, std::vector<uint8_t>, KeyHash > mapTransactions;
 
         /** Keychain items to commit. */
-        std::set< std::vector<uint8_t> > setKeychain;
+        std::unordered_set< std::vector<uint8_t>, KeyHash > setKeychain;
 
         /** Index items to commit. */
-        std::map< std::vector<uint8_t>, std::vector<uint8_t> > mapIndex;
+        std::unordered_map< std::vector<uint8_t>, std::vector<uint8_t>, KeyHash > mapIndex;
 
         /** Vector to hold the keys of transactions to be erased. **/
-        std::set< std::vector<uint8_t> > setErasedData;
+        std::unordered_set< std::vector<uint8_t>, KeyHash > setErasedData;
 
         /** Binary stream with data to be written. **/
         DataStream ssJournal;
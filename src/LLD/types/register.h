@@ -22,15 +22,22 @@ ________________________________________________________________________________
 #include <LLD/keychain/hashmap.h>
 
 #include <TAO/Register/types/state.h>
+#include <TAO/Register/types/metrics.h>
 
 #include <TAO/Ledger/include/enum.h>
 
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace LLD
 {
 
     /** RegisterTransaction
      *
      *  Helper class for managing memory states in register database.
+     *  States are immutable once written, so layers share them by pointer and readers
+     *  take a reference under the memory lock then copy outside of it.
      *
      **/
     class RegisterTransaction
@@ -38,11 +45,11 @@ namespace LLD
     public:
 
         /** Map of states that are stored in memory mode until commited. **/
-        std::map<uint256_t, TAO::Register::State> mapStates;
+        std::unordered_map<uint256_t, std::shared_ptr<const TAO::Register::State>> mapStates;
 
 
         /** Set of indexes to remove during commit. **/
-        std::set<uint256_t> setErase;
+        std::unordered_set<uint256_t> setErase;
 
     };
 
@@ -71,6 +78,14 @@ namespace LLD
         RegisterTransaction* pCommit;
 
 
+        /** Metrics mutex to serialize updates of the register aggregates. **/
+        std::mutex METRICS_MUTEX;
+
+
+        /** Flag to determine if register aggregates have been indexed. **/
+        std::atomic<bool> fMetrics;
+
+
     public:
 
 
@@ -205,6 +220,29 @@ namespace LLD
         bool HasState(const uint256_t& hashRegister, const uint8_t nFlags = TAO::Ledger::FLAGS::BLOCK);
 
 
+        /** ReadMetrics
+         *
+         *  Read the chain-wide aggregates over all registers on disk.
+         *
+         *  @param[out] metrics The register aggregates.
+         *
+         *  @return True if the aggregates have been indexed, false otherwise.
+         *
+         **/
+        bool ReadMetrics(TAO::Register::Metrics& metrics);
+
+
+        /** IndexMetrics
+         *
+         *  Build the register aggregates with a full scan if they don't exist yet. This only
+         *  scans once for a database created before aggregates were tracked.
+         *
+         *  @return True if the aggregates are indexed, false otherwise.
+         *
+         **/
+        bool IndexMetrics();
+
+
         /** MemoryBegin
          *
          *  Begin a memory transaction following ACID properties.
@@ -228,6 +266,36 @@ namespace LLD
          **/
         void MemoryCommit();
 
+
+    private:
+
+        /** read_memory
+         *
+         *  Get a register's newest state from the memory layers for the given flags.
+         *
+         *  @param[in] hashRegister The register address.
+         *  @param[in] nFlags The flags to determine which memory layers to check.
+         *
+         *  @return The shared state, nullptr if not held in memory.
+         *
+         **/
+        std::shared_ptr<const TAO::Register::State> read_memory(const uint256_t& hashRegister, const uint8_t nFlags);
+
+
+        /** update_metrics
+         *
+         *  Update the register aggregates for a state being replaced on disk.
+         *
+         *  @param[in] hashRegister The register address.
+         *  @param[in] pstatePrev The previous state on disk, nullptr if none.
+         *  @param[in] pstateNext The new state on disk, nullptr if erased.
+         *
+         *  @return True if the aggregates were updated, false otherwise.
+         *
+         **/
+        bool update_metrics(const uint256_t& hashRegister,
+            const TAO::Register::State* pstatePrev, const TAO::Register::State* pstateNext);
+
     };
 
 }
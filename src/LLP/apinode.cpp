@@ -100,7 +100,6 @@ namespace LLP
         std::string METHOD = INCOMING.strRequest.substr(npos + 1);
 
         /* Extract the parameters. */
-        json::json ret;
         try
         {
             json::json params;
@@ -200,29 +199,59 @@ namespace LLP
                 return true;
             }
 
+            /* Copy what the worker needs, since it can't touch this node. */
+            const std::string strOrigin = INCOMING.mapHeaders.count("origin") ? INCOMING.mapHeaders["origin"] : "";
+
+            /* Execute the method on the request workers. */
+            if(!Dispatch(strAPI + "/" + METHOD, [strAPI, METHOD, params, strOrigin]
+                {
+                    return Execute(strAPI, METHOD, params, strOrigin);
+                }))
+                throw TAO::API::APIException(-256, "Server busy, request queue is full");
+        }
+
+        /* Handle for custom API exceptions. */
+        catch(TAO::API::APIException& e)
+        {
+            /* Send the error response. */
+            this->WritePacket(ErrorResponse(e.ToJSON(), INCOMING.mapHeaders.count("origin") ? INCOMING.mapHeaders["origin"] : ""));
+
+            return false;
+        }
+
+        return true;
+    }
+
+
+    /* Execute an API method and build the response. */
+    HTTPPacket APINode::Execute(const std::string& strAPI, const std::string& strMethod, const json::json& params, const std::string& strOrigin)
+    {
+        json::json ret;
+        try
+        {
             /* Execute the api and methods. */
             if(strAPI == "supply")
-                ret = { {"result", TAO::API::supply->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::supply->Execute(strMethod, params) } };
             else if(strAPI == "users")
-                ret = { {"result", TAO::API::users->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::users->Execute(strMethod, params) } };
             else if(strAPI == "assets")
-                ret = { {"result", TAO::API::assets->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::assets->Execute(strMethod, params) } };
             else if(strAPI == "ledger")
-                ret = { {"result", TAO::API::ledger->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::ledger->Execute(strMethod, params) } };
             else if(strAPI == "tokens")
-                ret = { {"result", TAO::API::tokens->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::tokens->Execute(strMethod, params) } };
             else if(strAPI == "system")
-                ret = { {"result", TAO::API::system->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::system->Execute(strMethod, params) } };
             else if(strAPI == "finance")
-                ret = { {"result", TAO::API::finance->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::finance->Execute(strMethod, params) } };
             else if(strAPI == "names")
-                ret = { {"result", TAO::API::names->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::names->Execute(strMethod, params) } };
             else if(strAPI == "dex")
-                ret = { {"result", TAO::API::dex->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::dex->Execute(strMethod, params) } };
             else if(strAPI == "voting")
-                ret = { {"result", TAO::API::voting->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::voting->Execute(strMethod, params) } };
             else if(strAPI == "invoices")
-                ret = { {"result", TAO::API::invoices->Execute(METHOD, params) } };
+                ret = { {"result", TAO::API::invoices->Execute(strMethod, params) } };
             else
                 throw TAO::API::APIException(-4, debug::safe_printstr("API not found: ", strAPI));
         }
@@ -230,58 +259,70 @@ namespace LLP
         /* Handle for custom API exceptions. */
         catch(TAO::API::APIException& e)
         {
-            /* Get error from exception. */
-            json::json jsonError = e.ToJSON();
+            return ErrorResponse(e.ToJSON(), strOrigin);
+        }
 
-            /* Default error status code is 500. */
-            uint16_t nStatus = 500;
-            int32_t nError = jsonError["code"].get<int32_t>();
+        /* Handle for STD exceptions, since there is no data thread to disconnect us anymore. */
+        catch(const std::exception& e)
+        {
+            return ErrorResponse(TAO::API::APIException(-1, e.what()).ToJSON(), strOrigin);
+        }
 
-            /* Set status by error code. */
-            switch(nError)
-            {
-                //API not found error code
-                case -4:
-                    nStatus = 404;
-                    break;
-
-                //unsupported content type
-                case -5:
-                    nStatus = 500;
-                    break;
-
-                //content type not provided
-                case -6:
-                    nStatus = 500;
-                    break;
-            }
+        /* Build packet. */
+        HTTPPacket RESPONSE(200);
+        if(!strOrigin.empty())
+            RESPONSE.mapHeaders["Access-Control-Allow-Origin"] = strOrigin;
 
-            /* Send the response packet. */
-            json::json ret = { { "error", jsonError } };
+        /* Add content. */
+        RESPONSE.strContent = ret.dump();
 
-            /* Build packet. */
-            HTTPPacket RESPONSE(nStatus);
-            if(INCOMING.mapHeaders.count("origin"))
-                RESPONSE.mapHeaders["Access-Control-Allow-Origin"] = INCOMING.mapHeaders["origin"];
+        return RESPONSE;
+    }
 
-            /* Add content. */
-            RESPONSE.strContent = ret.dump();
-            this->WritePacket(RESPONSE);
 
-            return false;
+    /* Build an error response for an API exception. */
+    HTTPPacket APINode::ErrorResponse(const json::json& jsonError, const std::string& strOrigin)
+    {
+        /* Default error status code is 500. */
+        uint16_t nStatus = 500;
+        int32_t nError = jsonError["code"].get<int32_t>();
+
+        /* Set status by error code. */
+        switch(nError)
+        {
+            //API not found error code
+            case -4:
+                nStatus = 404;
+                break;
+
+            //unsupported content type
+            case -5:
+                nStatus = 500;
+                break;
+
+            //content type not provided
+            case -6:
+                nStatus = 500;
+                break;
+
+            //request queue is full
+            case -256:
+                nStatus = 503;
+                break;
         }
 
+        /* Send the response packet. */
+        json::json ret = { { "error", jsonError } };
 
         /* Build packet. */
-        HTTPPacket RESPONSE(200);
-        if(INCOMING.mapHeaders.count("origin"))
-            RESPONSE.mapHeaders["Access-Control-Allow-Origin"] = INCOMING.mapHeaders["origin"];
+        HTTPPacket RESPONSE(nStatus);
+        if(!strOrigin.empty())
+            RESPONSE.mapHeaders["Access-Control-Allow-Origin"] = strOrigin;
 
         /* Add content. */
         RESPONSE.strContent = ret.dump();
-        this->WritePacket(RESPONSE);
 
-        return true;
+        return RESPONSE;
     }
 
 
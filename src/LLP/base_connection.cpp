@@ -159,12 +159,28 @@ namespace LLP
     }
 
 
+    /* Checks if data already read from the socket can still be parsed into the packet. */
+    template <class PacketType>
+    bool BaseConnection<PacketType>::PacketPending() const
+    {
+        return false;
+    }
+
+
     /*  Write a single packet to the TCP stream. */
     template <class PacketType>
     void BaseConnection<PacketType>::WritePacket(const PacketType& PACKET)
+    {
+        WritePacket(std::make_shared<const std::vector<uint8_t>>(PACKET.GetBytes()));
+    }
+
+
+    /*  Write an already encoded packet to the TCP stream. */
+    template <class PacketType>
+    void BaseConnection<PacketType>::WritePacket(const std::shared_ptr<const std::vector<uint8_t>>& pBytes)
     {
         /* Get the bytes of the packet. */
-        const std::vector<uint8_t> vBytes = PACKET.GetBytes();
+        const std::vector<uint8_t>& vBytes = *pBytes;
 
         /* Stop sending packets if send buffer is full. */
         uint64_t nMaxSendBuffer = config::GetArg("-maxsendbuffer", MAX_SEND_BUFFER);
@@ -179,7 +195,7 @@ namespace LLP
                 PrintHex(vBytes);
 
             /* Write the packet to socket buffer. */
-            Write(vBytes, vBytes.size());
+            Write(pBytes);
 
             /* Update packet count. */
             ++PACKETS;
@@ -46,6 +46,8 @@ namespace LLP
     , DDOS_cSCORE     (cScore)
     , CONNECTIONS     (memory::atomic_ptr< std::vector<memory::atomic_ptr<ProtocolType>> >(new std::vector<memory::atomic_ptr<ProtocolType>>()))
     , RELAY           (memory::atomic_ptr< std::queue<std::pair<typename ProtocolType::message_t, DataStream>> >(new std::queue<std::pair<typename ProtocolType::message_t, DataStream>>()))
+    , POLLER          ( )
+    , TIMERS          (static_cast<uint32_t>(config::GetArg("-llpinterval", 100)), 128)
     , CONDITION       ( )
     , DATA_THREAD     (std::bind(&DataThread::Thread, this))
     , FLUSH_CONDITION ( )
@@ -103,6 +105,10 @@ namespace LLP
                 memory::atomic_ptr<ProtocolType>& CONNECTION = CONNECTIONS->at(nSlot);
                 CONNECTION->Event(EVENT_CONNECT);
 
+                /* Register for read events and schedule maintenance. */
+                POLLER.Add(CONNECTION->fd, nSlot);
+                TIMERS.Schedule(nSlot, runtime::timestamp(true));
+
                 /* Iterate the DDOS cScore (Connection score). */
                 if(DDOS)
                     DDOS -> cSCORE += 1;
@@ -161,6 +167,10 @@ namespace LLP
                 memory::atomic_ptr<ProtocolType>& CONNECTION = CONNECTIONS->at(nSlot);
                 CONNECTION->Event(EVENT_CONNECT);
 
+                /* Register for read events and schedule maintenance. */
+                POLLER.Add(CONNECTION->fd, nSlot);
+                TIMERS.Schedule(nSlot, runtime::timestamp(true));
+
                 /* Check for inbound socket. */
                 if(CONNECTION->Incoming())
                     ++nIncoming;
@@ -210,13 +220,20 @@ namespace LLP
         /* Cache sleep time if applicable. */
         uint32_t nSleep = config::GetArg("-llpsleep", 0);
 
+        /* Cache the interval for connection maintenance and generic events. */
+        uint32_t nInterval = config::GetArg("-llpinterval", 100);
+
         /* The mutex for the condition. */
         std::mutex CONDITION_MUTEX;
 
-        /* This mirrors CONNECTIONS with pollfd settings for passing to poll methods.
-         * Windows throws SOCKET_ERROR intermittently if pass CONNECTIONS directly.
-         */
-        std::vector<pollfd> POLLFDS;
+        /* The events returned from the poller. */
+        std::vector<Poller::Event> vEvents;
+
+        /* Sockets that still have data after being read, needed for edge triggered polling. */
+        std::vector<Poller::Event> vPending;
+
+        /* Slots whose maintenance timer has expired. */
+        std::vector<uint32_t> vExpired;
 
         /* The main connection handler loop. */
         while(!fDestruct.load() && !config::fShutdown.load())
@@ -242,47 +259,8 @@ namespace LLP
             if(fDestruct.load() || config::fShutdown.load())
                 return;
 
-            /* Wrapped mutex lock. */
-            uint32_t nSize = static_cast<uint32_t>(CONNECTIONS->size());
-
-            /* Check the pollfd's size. */
-            if(POLLFDS.size() != nSize)
-                POLLFDS.resize(nSize);
-
-            /* Initialize the revents for all connection pollfd structures.
-             * One connection must be live, so verify that and skip if none
-             */
-            for(uint32_t nIndex = 0; nIndex < nSize; ++nIndex)
-            {
-                try
-                {
-                    /* Set the proper POLLIN flags. */
-                    POLLFDS.at(nIndex).events  = POLLIN;// | POLLRDHUP;
-                    POLLFDS.at(nIndex).revents = 0; //reset return events
-
-                    /* Set to invalid socket if connection is inactive. */
-                    if(!CONNECTIONS->at(nIndex))
-                    {
-                        POLLFDS.at(nIndex).fd = INVALID_SOCKET;
-
-                        continue;
-                    }
-
-                    /* Set the correct file descriptor. */
-                    POLLFDS.at(nIndex).fd = CONNECTIONS->at(nIndex)->fd;
-                }
-                catch(const std::exception& e)
-                {
-                    debug::error(FUNCTION, e.what());
-                }
-            }
-
-            /* Poll the sockets. */
-#ifdef WIN32
-            int32_t nPoll = WSAPoll((pollfd*)&POLLFDS[0], nSize, 100);
-#else
-            int32_t nPoll = poll((pollfd*)&POLLFDS[0], nSize, 100);
-#endif
+            /* Poll the sockets, don't block if we still have data left to read. */
+            int32_t nPoll = POLLER.Wait(vEvents, vPending.empty() ? nInterval : 0);
 
             /* Check poll for available sockets. */
             if(nPoll < 0)
@@ -291,10 +269,14 @@ namespace LLP
                 continue;
             }
 
+            /* Add the sockets that weren't drained on last pass. */
+            vEvents.insert(vEvents.end(), vPending.begin(), vPending.end());
+            vPending.clear();
 
-            /* Check all connections for data and packets. */
-            for(uint32_t nIndex = 0; nIndex < nSize; ++nIndex)
+            /* Only check connections that were reported by the poller. */
+            for(const auto& event : vEvents)
             {
+                const uint32_t nIndex = event.nSlot;
                 try
                 {
                     /* Load the atomic pointer raw data. */
@@ -305,19 +287,105 @@ namespace LLP
                         continue;
 
                     /* Disconnect if there was a polling error */
-                    if(POLLFDS.at(nIndex).revents & POLLERR)
+                    if(event.nFlags & Poller::FAILED)
                     {
                          disconnect_remove_event(nIndex, DISCONNECT_POLL_ERROR);
                          continue;
                     }
 
                     /* Disconnect if the socket was disconnected by peer (need for Windows) */
-                    if(POLLFDS.at(nIndex).revents & POLLHUP)
+                    if(event.nFlags & Poller::HANGUP)
                     {
                         disconnect_remove_event(nIndex, DISCONNECT_PEER);
                         continue;
                     }
 
+                    /* Flush our buffers when socket is writable again. */
+                    if(event.nFlags & Poller::WRITABLE)
+                    {
+                        if(CONNECTION->Flush() >= 0 && CONNECTION->Buffered() == 0)
+                            POLLER.Write(CONNECTION->fd, nIndex, false);
+                    }
+
+                    /* Skip if there is nothing to read. */
+                    if(!(event.nFlags & Poller::READABLE))
+                        continue;
+
+                    /* Disconnect if read signaled with no data, level triggered sockets only signal with data. */
+                    const uint32_t nAvailable = CONNECTION->Available();
+                    if(nAvailable == 0 && !CONNECTION->PacketPending())
+                    {
+                        if(!Poller::EdgeTriggered() || (event.nFlags & Poller::CLOSED))
+                            disconnect_remove_event(nIndex, DISCONNECT_POLL_EMPTY);
+
+                        continue;
+                    }
+
+                    /* Work on Reading a Packet. **/
+                    CONNECTION->ReadPacket();
+
+                    /* If a Packet was received successfully, increment request count [and DDOS count if enabled]. */
+                    if(CONNECTION->PacketComplete())
+                    {
+                        /* Debug dump of message type. */
+                        if(config::GetArg("-verbose", 0) >= 4)
+                            debug::log(4, FUNCTION, "Recieved Message (", CONNECTION->INCOMING.GetBytes().size(), " bytes)");
+
+                        /* Debug dump of packet data. */
+                        if(config::GetArg("-verbose", 0) >= 5)
+                            PrintHex(CONNECTION->INCOMING.GetBytes());
+
+                        /* Handle Meters and DDOS. */
+                        if(fMETER)
+                            ++ProtocolType::REQUESTS;
+
+                        /* Increment rScore. */
+                        if(fDDOS && CONNECTION->DDOS)
+                            CONNECTION->DDOS->rSCORE += 1;
+
+                        /* Packet Process return value of False will flag Data Thread to Disconnect. */
+                        if(!CONNECTION->ProcessPacket())
+                        {
+                            disconnect_remove_event(nIndex, DISCONNECT_FORCE);
+                            continue;
+                        }
+
+                        CONNECTION->ResetPacket();
+                    }
+
+                    /* Edge triggered sockets won't signal again until we have drained them. Only read again if the last
+                     * read made progress, otherwise a partial packet waits for the next edge rather than spinning. */
+                    const bool fProgress = CONNECTION->PacketPending()
+                        || (CONNECTION->Available() > 0 && CONNECTION->Available() < nAvailable);
+
+                    if(Poller::EdgeTriggered() && CONNECTION->Connected() && fProgress)
+                        vPending.push_back(event);
+
+                    /* A half closed peer won't signal again, so drop it once we have read everything it sent. */
+                    else if((event.nFlags & Poller::CLOSED) && !fProgress)
+                        disconnect_remove_event(nIndex, DISCONNECT_PEER);
+                }
+                catch(const std::exception& e)
+                {
+                    debug::error(FUNCTION, "Data Connection: ", e.what());
+                    disconnect_remove_event(nIndex, DISCONNECT_ERRORS);
+                }
+            }
+
+            /* Run timeouts, buffer and DDOS checks only for connections that are due. */
+            const uint64_t nTimestamp = runtime::timestamp(true);
+            TIMERS.Expire(nTimestamp, vExpired);
+            for(const auto& nIndex : vExpired)
+            {
+                try
+                {
+                    /* Load the atomic pointer raw data. */
+                    ProtocolType* CONNECTION = CONNECTIONS->at(nIndex).load();
+
+                    /* Skip over Inactive Connections. */
+                    if(!CONNECTION || !CONNECTION->Connected())
+                        continue;
+
                     /* Remove Connection if it has Timed out or had any read/write Errors. */
                     if(CONNECTION->Errors())
                     {
@@ -332,14 +400,6 @@ namespace LLP
                         continue;
                     }
 
-                    /* Disconnect if pollin signaled with no data (This happens on Linux). */
-                    if((POLLFDS.at(nIndex).revents & POLLIN)
-                    && CONNECTION->Available() == 0)
-                    {
-                        disconnect_remove_event(nIndex, DISCONNECT_POLL_EMPTY);
-                        continue;
-                    }
-
                     /* Disconnect if buffer is full and remote host isn't reading at all. */
                     if(CONNECTION->Buffered()
                     && CONNECTION->Timeout(15000, Socket::WRITE))
@@ -375,37 +435,12 @@ namespace LLP
                     /* Generic event for Connection. */
                     CONNECTION->Event(EVENT_GENERIC);
 
-                    /* Work on Reading a Packet. **/
-                    CONNECTION->ReadPacket();
+                    /* Make sure we are notified when buffered data can be written. */
+                    if(CONNECTION->Buffered())
+                        POLLER.Write(CONNECTION->fd, nIndex, true);
 
-                    /* If a Packet was received successfully, increment request count [and DDOS count if enabled]. */
-                    if(CONNECTION->PacketComplete())
-                    {
-                        /* Debug dump of message type. */
-                        if(config::GetArg("-verbose", 0) >= 4)
-                            debug::log(4, FUNCTION, "Recieved Message (", CONNECTION->INCOMING.GetBytes().size(), " bytes)");
-
-                        /* Debug dump of packet data. */
-                        if(config::GetArg("-verbose", 0) >= 5)
-                            PrintHex(CONNECTION->INCOMING.GetBytes());
-
-                        /* Handle Meters and DDOS. */
-                        if(fMETER)
-                            ++ProtocolType::REQUESTS;
-
-                        /* Increment rScore. */
-                        if(fDDOS && CONNECTION->DDOS)
-                            CONNECTION->DDOS->rSCORE += 1;
-
-                        /* Packet Process return value of False will flag Data Thread to Disconnect. */
-                        if(!CONNECTION->ProcessPacket())
-                        {
-                            disconnect_remove_event(nIndex, DISCONNECT_FORCE);
-                            continue;
-                        }
-
-                        CONNECTION->ResetPacket();
-                    }
+                    /* Schedule the next maintenance pass. */
+                    TIMERS.Schedule(nIndex, nTimestamp + nInterval);
                 }
                 catch(const std::exception& e)
                 {
@@ -469,40 +504,68 @@ namespace LLP
                 std::make_pair(typename ProtocolType::message_t(), DataStream(SER_NETWORK, MIN_PROTO_VERSION));
 
             /* Grab data from queue. */
+            bool fRelay = false;
             if(!RELAY->empty())
             {
-                /* Make a copy of the relay data. */
-                qRelay = RELAY->front();
+                /* Only this thread pops, so the front stays valid while we move it out. */
+                qRelay = std::move(RELAY->front());
                 RELAY->pop();
+
+                fRelay = true;
             }
 
+            /* Encoded relay packets by subscription key, so each filter is evaluated and serialized only once. */
+            std::map<uint64_t, std::shared_ptr<const std::vector<uint8_t>>> mapRelay;
+
             /* Check all connections for data and packets. */
             uint32_t nSize = CONNECTIONS->size();
             for(uint32_t nIndex = 0; nIndex < nSize; ++nIndex)
             {
                 try
                 {
-                    /* Reset stream read position. */
-                    qRelay.second.Reset();
-
                     /* Get atomic pointer to reduce locking around CONNECTIONS scope. */
                     memory::atomic_ptr<ProtocolType>& CONNECTION = CONNECTIONS->at(nIndex);
 
                     /* Relay if there are active subscriptions. */
-                    const DataStream ssRelay = CONNECTION->Notifications(qRelay.first, qRelay.second);
-                    if(ssRelay.size() != 0)
+                    if(fRelay)
                     {
-                        /* Build the sender packet. */
-                        typename ProtocolType::packet_t PACKET = typename ProtocolType::packet_t(qRelay.first);
-                        PACKET.SetData(ssRelay);
+                        /* Check if we have already encoded this relay for these subscriptions. */
+                        const uint64_t nSubscriptions = CONNECTION->Subscriptions();
+                        if(!mapRelay.count(nSubscriptions))
+                        {
+                            /* Reset stream read position. */
+                            qRelay.second.Reset();
+
+                            /* Filter the relay for this set of subscriptions. */
+                            std::shared_ptr<const std::vector<uint8_t>> pBytes;
+
+                            const DataStream ssRelay = CONNECTION->Notifications(qRelay.first, qRelay.second);
+                            if(ssRelay.size() != 0)
+                            {
+                                /* Build the sender packet. */
+                                typename ProtocolType::packet_t PACKET = typename ProtocolType::packet_t(qRelay.first);
+                                PACKET.SetData(ssRelay);
+
+                                /* Encode the packet once for all matching connections. */
+                                pBytes = std::make_shared<const std::vector<uint8_t>>(PACKET.GetBytes());
+                            }
 
-                        /* Write packet to socket. */
-                        CONNECTION->WritePacket(PACKET);
+                            mapRelay[nSubscriptions] = pBytes;
+                        }
+
+                        /* Write shared packet to socket. */
+                        const std::shared_ptr<const std::vector<uint8_t>>& pBytes = mapRelay[nSubscriptions];
+                        if(pBytes)
+                            CONNECTION->WritePacket(pBytes);
                     }
 
                     /* Attempt to flush data when buffer is available. */
                     if(CONNECTION->Buffered() && CONNECTION->Flush() < 0)
                         runtime::sleep(std::min(5u, CONNECTION->nConsecutiveErrors.load() / 1000)); //we want to sleep when we have periodic failures
+
+                    /* Have the data thread finish the flush once the socket is writable. */
+                    if(CONNECTION->Buffered())
+                        POLLER.Write(CONNECTION->fd, nIndex, true);
                 }
                 catch(const std::exception& e) { }
             }
@@ -564,6 +627,10 @@ namespace LLP
         else
             --nOutbound;
 
+        /* Stop polling this slot. */
+        POLLER.Remove(CONNECTIONS->at(nIndex)->fd, nIndex);
+        TIMERS.Cancel(nIndex);
+
         /* Free the memory. */
         CONNECTIONS->at(nIndex).free();
         CONDITION.notify_all();
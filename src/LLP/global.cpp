@@ -15,6 +15,7 @@ ________________________________________________________________________________
 
 #include <LLP/include/global.h>
 #include <LLP/include/network.h>
+#include <LLP/include/request_pool.h>
 
 namespace LLP
 {
@@ -59,6 +60,9 @@ namespace LLP
         /* Shutdown the mining server and its subsystems. */
         Shutdown<Miner>(MINING_SERVER);
 
+        /* Delete the request workers once no server can dispatch to them. */
+        delete REQUEST_POOL.exchange(nullptr);
+
         /* After all servers shut down, clean up underlying network resources. */
         NetworkShutdown();
     }
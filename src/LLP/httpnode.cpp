@@ -13,7 +13,9 @@ ________________________________________________________________________________
 
 #include <LLP/types/httpnode.h>
 #include <LLP/templates/ddos.h>
+#include <LLP/include/request_pool.h>
 
+#include <Util/include/mutex.h>
 #include <Util/include/string.h>
 
 #include <algorithm>
@@ -21,10 +23,50 @@ ________________________________________________________________________________
 namespace LLP
 {
 
+    /* Constructor */
+    Responder::Responder(HTTPNode* pNodeIn)
+    : RESPONDER_MUTEX ( )
+    , pNode           (pNodeIn)
+    {
+    }
+
+
+    /* Detach from the node, waiting for any response in progress. */
+    void Responder::Release()
+    {
+        LOCK(RESPONDER_MUTEX);
+        pNode = nullptr;
+    }
+
+
+    /* Check if the node is still connected and waiting for a response. */
+    bool Responder::Active()
+    {
+        LOCK(RESPONDER_MUTEX);
+        return pNode && pNode->Connected();
+    }
+
+
+    /* Write a response packet to the node if it is still connected. */
+    bool Responder::Respond(const HTTPPacket& RESPONSE)
+    {
+        LOCK(RESPONDER_MUTEX);
+
+        /* Check that our node is still around. */
+        if(!pNode || !pNode->Connected())
+            return false;
+
+        pNode->WritePacket(RESPONSE);
+
+        return true;
+    }
+
+
     /** Default Constructor **/
     HTTPNode::HTTPNode()
     : BaseConnection<HTTPPacket> ( )
     , vchBuffer                  ( )
+    , pResponder                 (std::make_shared<Responder>(this))
     {
     }
 
@@ -33,6 +75,7 @@ namespace LLP
     HTTPNode::HTTPNode(const Socket &SOCKET_IN, DDOS_Filter* DDOS_IN, bool fDDOSIn)
     : BaseConnection<HTTPPacket> (SOCKET_IN, DDOS_IN, fDDOSIn)
     , vchBuffer                  ( )
+    , pResponder                 (std::make_shared<Responder>(this))
     {
     }
 
@@ -41,6 +84,7 @@ namespace LLP
     HTTPNode::HTTPNode(DDOS_Filter* DDOS_IN, bool fDDOSIn)
     : BaseConnection<HTTPPacket> (DDOS_IN, fDDOSIn)
     , vchBuffer                  ( )
+    , pResponder                 (std::make_shared<Responder>(this))
     {
     }
 
@@ -48,6 +92,8 @@ namespace LLP
     /** Default Destructor **/
     HTTPNode::~HTTPNode()
     {
+        /* Make sure no request worker can write to us once we are gone. */
+        pResponder->Release();
     }
 
 
@@ -160,6 +206,22 @@ namespace LLP
     }
 
 
+    /* Checks if the read buffer still holds header lines or content to parse. */
+    bool HTTPNode::PacketPending() const
+    {
+        /* Nothing to parse until more data arrives. */
+        if(vchBuffer.empty())
+            return false;
+
+        /* Content is moved in a single pass once the header is done. */
+        if(INCOMING.fHeader)
+            return true;
+
+        /* Headers are only parsed a full line at a time. */
+        return std::find(vchBuffer.begin(), vchBuffer.end(), '\n') != vchBuffer.end();
+    }
+
+
     /* Returns an HTTP packet with response code and content. */
     void HTTPNode::PushResponse(const uint16_t nMsg, const std::string& strContent)
     {
@@ -177,4 +239,29 @@ namespace LLP
         }
     }
 
+
+    /* Queue a request to execute on the request workers, posting the response back to this node. */
+    bool HTTPNode::Dispatch(const std::string& strMethod, const std::function<HTTPPacket()>& fnExecute)
+    {
+        /* Execute inline if there are no request workers. */
+        RequestPool* pPool = REQUEST_POOL.load();
+        if(!pPool)
+        {
+            this->WritePacket(fnExecute());
+            return true;
+        }
+
+        /* The worker only holds our responder, never a pointer to this node. */
+        std::shared_ptr<Responder> pResponse = pResponder;
+        return pPool->Submit(strMethod, pResponse.get(), [pResponse, fnExecute]
+        {
+            /* Don't bother executing if our client has already gone. */
+            if(!pResponse->Active())
+                return;
+
+            if(!pResponse->Respond(fnExecute()))
+                debug::log(3, FUNCTION, "connection closed before response");
+        });
+    }
+
 }
@@ -0,0 +1,168 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLP_INCLUDE_POLLER_H
+#define NEXUS_LLP_INCLUDE_POLLER_H
+
+#include <LLP/include/network.h>
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+#if defined(__linux__)
+#define USE_EPOLL
+#include <sys/epoll.h>
+#endif
+
+namespace LLP
+{
+
+    /** Poller
+     *
+     *  Readiness notification backend for a data thread. Sockets are registered once and are
+     *  reported only when they have work. On Linux this uses edge-triggered epoll, elsewhere
+     *  it falls back to a persistent pollfd set passed to poll / WSAPoll.
+     *
+     **/
+    class Poller
+    {
+    public:
+
+        /** Readiness flags reported by Wait. **/
+        enum
+        {
+            READABLE = (1 << 1),
+            WRITABLE = (1 << 2),
+            FAILED   = (1 << 3),
+            HANGUP   = (1 << 4),
+            CLOSED   = (1 << 5), //remote host closed its write side
+        };
+
+
+        /** Event
+         *
+         *  A readiness event for a given data thread slot.
+         *
+         **/
+        struct Event
+        {
+            /** The slot in the data thread this event belongs to. **/
+            uint32_t nSlot;
+
+
+            /** The readiness flags for this slot. **/
+            uint8_t nFlags;
+        };
+
+
+    private:
+
+        /** Mutex to protect registration state. **/
+        std::mutex POLLER_MUTEX;
+
+
+        /** Track slots that have write notifications armed. **/
+        std::vector<bool> vWriting;
+
+
+    #ifdef USE_EPOLL
+
+        /** The epoll instance file descriptor. **/
+        int32_t nEpoll;
+
+
+        /** Buffer for epoll_wait results. **/
+        std::vector<epoll_event> vEvents;
+
+    #else
+
+        /** Persistent set of pollfd indexed by slot. **/
+        std::vector<pollfd> vPoll;
+
+    #endif
+
+
+    public:
+
+        /** Default Constructor. **/
+        Poller();
+
+
+        /** Default Destructor. **/
+        ~Poller();
+
+
+        /** EdgeTriggered
+         *
+         *  Flag to determine if readiness is only reported on state changes.
+         *  When this is true, callers must keep reading until a socket is drained.
+         *
+         **/
+        static bool EdgeTriggered();
+
+
+        /** Add
+         *
+         *  Register a socket for read notifications under given slot.
+         *
+         *  @param[in] hSocket The socket file descriptor.
+         *  @param[in] nSlot The data thread slot.
+         *
+         *  @return true if the socket was registered.
+         *
+         **/
+        bool Add(const SOCKET hSocket, const uint32_t nSlot);
+
+
+        /** Remove
+         *
+         *  Remove a socket from the notification set.
+         *
+         *  @param[in] hSocket The socket file descriptor.
+         *  @param[in] nSlot The data thread slot.
+         *
+         **/
+        void Remove(const SOCKET hSocket, const uint32_t nSlot);
+
+
+        /** Write
+         *
+         *  Arm or disarm write notifications for a socket. Only sockets with buffered data
+         *  should be armed, otherwise they would be reported on every wait.
+         *
+         *  @param[in] hSocket The socket file descriptor.
+         *  @param[in] nSlot The data thread slot.
+         *  @param[in] fArm Flag to arm or disarm write notifications.
+         *
+         **/
+        void Write(const SOCKET hSocket, const uint32_t nSlot, const bool fArm);
+
+
+        /** Wait
+         *
+         *  Wait for sockets to become ready.
+         *
+         *  @param[out] vReady The events that were triggered.
+         *  @param[in] nTimeout The maximum time in milliseconds to wait.
+         *
+         *  @return the number of events, or negative on error.
+         *
+         **/
+        int32_t Wait(std::vector<Event> &vReady, const uint32_t nTimeout);
+
+    };
+}
+
+#endif
@@ -0,0 +1,251 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLP_INCLUDE_REQUEST_POOL_H
+#define NEXUS_LLP_INCLUDE_REQUEST_POOL_H
+
+#include <Util/include/runtime.h>
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace LLP
+{
+
+    /** RequestPool
+     *
+     *  Bounded pool of worker threads that execute API and RPC methods off of the data threads.
+     *  Requests are queued in order, each method is limited in how many workers it can occupy,
+     *  and requests from the same connection never run concurrently so responses stay in order.
+     *
+     **/
+    class RequestPool
+    {
+    public:
+
+        /** Stats
+         *
+         *  Latency counters for a single method, all times in microseconds.
+         *
+         **/
+        struct Stats
+        {
+            /** Total requests that finished executing. **/
+            uint64_t nCompleted;
+
+
+            /** Total requests rejected because the queue was full. **/
+            uint64_t nRejected;
+
+
+            /** Total requests currently executing. **/
+            uint32_t nActive;
+
+
+            /** Total time spent waiting in the queue. **/
+            uint64_t nQueueTime;
+
+
+            /** Longest time spent waiting in the queue. **/
+            uint64_t nQueueMax;
+
+
+            /** Total time spent executing. **/
+            uint64_t nExecuteTime;
+
+
+            /** Longest time spent executing. **/
+            uint64_t nExecuteMax;
+
+
+            /** Default Constructor. **/
+            Stats()
+            : nCompleted   (0)
+            , nRejected    (0)
+            , nActive      (0)
+            , nQueueTime   (0)
+            , nQueueMax    (0)
+            , nExecuteTime (0)
+            , nExecuteMax  (0)
+            {
+            }
+        };
+
+
+    private:
+
+        /** Job
+         *
+         *  A single queued request.
+         *
+         **/
+        struct Job
+        {
+            /** The method name used for limits and stats. **/
+            std::string strMethod;
+
+
+            /** The connection this request came from, used to keep its requests in order. **/
+            const void* pStrand;
+
+
+            /** The work to execute. **/
+            std::function<void()> fnExecute;
+
+
+            /** Timer started when the request was queued. **/
+            runtime::timer timeQueued;
+        };
+
+
+        /** Mutex to protect the queue and stats. **/
+        mutable std::mutex QUEUE_MUTEX;
+
+
+        /** Condition to wake the workers. **/
+        std::condition_variable CONDITION;
+
+
+        /** The pending requests in arrival order. **/
+        std::deque<Job> queueJobs;
+
+
+        /** Connections that have a request executing. **/
+        std::set<const void*> setStrands;
+
+
+        /** The stats for each method. **/
+        std::map<std::string, Stats> mapStats;
+
+
+        /** The maximum requests allowed to wait in the queue. **/
+        const uint32_t nMaxQueue;
+
+
+        /** The maximum workers a single method can occupy. **/
+        const uint32_t nMaxMethod;
+
+
+        /** Flag to tell the workers to stop. **/
+        std::atomic<bool> fStop;
+
+
+        /** The worker threads. **/
+        std::vector<std::thread> vThreads;
+
+
+    public:
+
+        /** Constructor
+         *
+         *  @param[in] nThreads The total worker threads.
+         *  @param[in] nMaxQueueIn The maximum requests allowed to wait in the queue.
+         *  @param[in] nMaxMethodIn The maximum workers a single method can occupy.
+         *
+         **/
+        RequestPool(const uint32_t nThreads, const uint32_t nMaxQueueIn, const uint32_t nMaxMethodIn);
+
+
+        /** Destructor **/
+        ~RequestPool();
+
+
+        /** Stop
+         *
+         *  Stops the workers, dropping any requests that haven't started. Any requests submitted
+         *  after this are rejected.
+         *
+         **/
+        void Stop();
+
+
+        /** Submit
+         *
+         *  Queue a request for execution.
+         *
+         *  @param[in] strMethod The method name used for limits and stats.
+         *  @param[in] pStrand The connection the request came from.
+         *  @param[in] fnExecute The work to execute.
+         *
+         *  @return true if queued, false if the queue is full.
+         *
+         **/
+        bool Submit(const std::string& strMethod, const void* pStrand, const std::function<void()>& fnExecute);
+
+
+        /** Pending
+         *
+         *  Get the total requests waiting in the queue.
+         *
+         **/
+        uint32_t Pending() const;
+
+
+        /** GetStats
+         *
+         *  Get a copy of the stats for each method.
+         *
+         **/
+        std::map<std::string, Stats> GetStats() const;
+
+
+    private:
+
+        /** Thread
+         *
+         *  Worker thread executing queued requests.
+         *
+         **/
+        void Thread();
+
+
+        /** next
+         *
+         *  Take the oldest request whose method is under its limit and whose connection is idle.
+         *  Must be called with QUEUE_MUTEX held.
+         *
+         *  @param[out] job The request that was taken.
+         *
+         *  @return true if a request was taken.
+         *
+         **/
+        bool next(Job& job);
+
+
+        /** stats
+         *
+         *  Get the stats entry for a method, folding unknown methods together once the map is full.
+         *  Must be called with QUEUE_MUTEX held.
+         *
+         **/
+        Stats& stats(const std::string& strMethod);
+
+    };
+
+
+    /** The request workers shared by the API and RPC servers. **/
+    extern std::atomic<RequestPool*> REQUEST_POOL;
+
+}
+
+#endif
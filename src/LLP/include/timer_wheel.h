@@ -0,0 +1,98 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_LLP_INCLUDE_TIMER_WHEEL_H
+#define NEXUS_LLP_INCLUDE_TIMER_WHEEL_H
+
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+namespace LLP
+{
+
+    /** TimerWheel
+     *
+     *  Hashed timing wheel keyed by data thread slot. Each slot has at most one pending
+     *  deadline, and expiring timers only touches the buckets that elapsed since the last call.
+     *
+     **/
+    class TimerWheel
+    {
+        /** Mutex to protect the wheel. **/
+        std::mutex WHEEL_MUTEX;
+
+
+        /** The resolution of each bucket in milliseconds. **/
+        uint64_t nResolution;
+
+
+        /** The last tick that was expired. **/
+        uint64_t nLastTick;
+
+
+        /** The buckets holding slot and deadline tick pairs. **/
+        std::vector< std::vector< std::pair<uint32_t, uint64_t> > > vBuckets;
+
+
+        /** The active deadline tick for each slot, 0 for none. **/
+        std::vector<uint64_t> vDeadlines;
+
+
+    public:
+
+        /** Constructor
+         *
+         *  @param[in] nResolutionIn The resolution of each bucket in milliseconds.
+         *  @param[in] nBuckets The total buckets in the wheel.
+         *
+         **/
+        TimerWheel(const uint32_t nResolutionIn, const uint32_t nBuckets);
+
+
+        /** Schedule
+         *
+         *  Set the deadline for a slot, replacing any previous deadline.
+         *
+         *  @param[in] nSlot The slot to schedule.
+         *  @param[in] nTimestamp The deadline in milliseconds.
+         *
+         **/
+        void Schedule(const uint32_t nSlot, const uint64_t nTimestamp);
+
+
+        /** Cancel
+         *
+         *  Clear any pending deadline for a slot.
+         *
+         *  @param[in] nSlot The slot to cancel.
+         *
+         **/
+        void Cancel(const uint32_t nSlot);
+
+
+        /** Expire
+         *
+         *  Collect all slots whose deadline has passed.
+         *
+         *  @param[in] nTimestamp The current time in milliseconds.
+         *  @param[out] vExpired The slots that expired.
+         *
+         **/
+        void Expire(const uint64_t nTimestamp, std::vector<uint32_t> &vExpired);
+
+    };
+}
+
+#endif
@@ -51,8 +51,8 @@ namespace LLP
     std::atomic<uint32_t> Miner::nLastNotificationsHeight(0);
 
 
-    /* The block iterator to act as extra nonce. */
-    std::atomic<uint32_t> Miner::nBlockIterator(0);
+    /* The miner id iterator to give each connection its own extra nonces. */
+    std::atomic<uint32_t> Miner::nMinerIterator(0);
 
     /* Default Constructor */
     Miner::Miner()
@@ -60,10 +60,13 @@ namespace LLP
     , CoinbaseTx()
     , mapBlocks()
     , nBestHeight(0)
+    , hashBestChain(0)
     , nSubscribed(0)
     , nChannel(0)
     , pMiningKey(nullptr)
     , nHashLast(0)
+    , nBlockIterator(0)
+    , nMinerID(++nMinerIterator)
     {
         pMiningKey = new Legacy::ReserveKey(&Legacy::Wallet::GetInstance());
     }
@@ -76,10 +79,13 @@ namespace LLP
     , MUTEX()
     , mapBlocks()
     , nBestHeight(0)
+    , hashBestChain(0)
     , nSubscribed(0)
     , nChannel(0)
     , pMiningKey(nullptr)
     , nHashLast(0)
+    , nBlockIterator(0)
+    , nMinerID(++nMinerIterator)
     {
         pMiningKey = new Legacy::ReserveKey(&Legacy::Wallet::GetInstance());
     }
@@ -92,10 +98,13 @@ namespace LLP
     , MUTEX()
     , mapBlocks()
     , nBestHeight(0)
+    , hashBestChain(0)
     , nSubscribed(0)
     , nChannel(0)
     , pMiningKey(nullptr)
     , nHashLast(0)
+    , nBlockIterator(0)
+    , nMinerID(++nMinerIterator)
     {
         pMiningKey = new Legacy::ReserveKey(&Legacy::Wallet::GetInstance());
     }
@@ -195,10 +204,13 @@ namespace LLP
                 if(count == 0)
                     return;
 
-                /* Check for a new round. */
+                /* Check for a new round. A new best block at the same height is pushed now, since subscribed workers don't
+                   poll for the zero height signal. */
                 {
                     LOCK(MUTEX);
-                    if(check_best_height())
+
+                    const uint1024_t hashRound = hashBestChain;
+                    if(check_best_height() && (nBestHeight.load() != 0 || hashBestChain == hashRound))
                         return;
                 }
 
@@ -695,6 +707,7 @@ namespace LLP
     bool Miner::check_best_height()
     {
         uint32_t nChainStateHeight = TAO::Ledger::ChainState::nBestHeight.load();
+        uint1024_t hashChainState  = TAO::Ledger::ChainState::hashBestChain.load();
 
         /* Introduced as part of Tritium upgrade. We can't rely on existing mining software to use the GET_ROUND to check that the
            the current round is still valid, so we additionally check the round whenever the height is checked.  If we find that it
@@ -710,6 +723,18 @@ namespace LLP
             return true;
         }
 
+        /* A new best block at the same height, such as from a reorganization, also ends the round. Set the height to 0 the
+           same as above so miners polling the height request new block data. */
+        if(nBestHeight == nChainStateHeight && hashBestChain != hashChainState)
+        {
+            hashBestChain = hashChainState;
+            clear_map();
+
+            nBestHeight = 0;
+
+            return true;
+        }
+
         /* Return early if the height doesn't change. */
         if(nBestHeight == nChainStateHeight)
             return false;
@@ -718,7 +743,8 @@ namespace LLP
         clear_map();
 
         /* Set the new best height. */
-        nBestHeight = nChainStateHeight;
+        nBestHeight   = nChainStateHeight;
+        hashBestChain = hashChainState;
         debug::log(2, FUNCTION, "Mining best height changed to ", nBestHeight);
 
         /* make sure the notifications processor hasn't been run already at this height */
@@ -813,7 +839,8 @@ namespace LLP
        TAO::Ledger::TritiumBlock *pBlock = new TAO::Ledger::TritiumBlock();
 
        /* Create a new block and loop for prime channel if minimum bit target length isn't met */
-       while(TAO::Ledger::CreateBlock(pSigChain, PIN, nChannel.load(), *pBlock, ++nBlockIterator, &CoinbaseTx))
+       while(TAO::Ledger::CreateBlock(pSigChain, PIN, nChannel.load(), *pBlock,
+           (uint64_t(nMinerID) << 32) | ++nBlockIterator, &CoinbaseTx))
        {
            /* Break out of loop when block is ready for prime mod. */
            if(is_prime_mod(nBitMask, pBlock))
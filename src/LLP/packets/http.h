@@ -249,6 +249,10 @@ namespace LLP
                 case 500:
                     strType = "500 Internal Server Error";
                     break;
+
+                case 503:
+                    strType = "503 Service Unavailable";
+                    break;
             }
 
             /* Set connection header. */
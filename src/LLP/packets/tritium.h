@@ -219,6 +219,20 @@ namespace LLP
         }
 
 
+        /** SetData
+         *
+         *  Set the Packet Data, taking the bytes of the datastream without copying them.
+         *
+         *  @param[in] ssData The datastream with the data to set.
+         *
+         **/
+        void SetData(DataStream&& ssData)
+        {
+            LENGTH = static_cast<uint32_t>(ssData.size());
+            DATA   = std::move(ssData.Bytes());
+        }
+
+
         /** IsValid
          *
          *  Check the Validity of the Packet.
@@ -250,7 +264,9 @@ namespace LLP
             DataStream ssHeader(SER_NETWORK, MIN_PROTO_VERSION);
             ssHeader << *this;
 
-            std::vector<uint8_t> vBytes(ssHeader.begin(), ssHeader.end());
+            std::vector<uint8_t> vBytes;
+            vBytes.reserve(ssHeader.size() + DATA.size());
+            vBytes.insert(vBytes.end(), ssHeader.begin(), ssHeader.end());
             vBytes.insert(vBytes.end(), DATA.begin(), DATA.end());
 
             return vBytes;
@@ -0,0 +1,239 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLP/include/poller.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+#include <Util/include/runtime.h>
+
+#include <cstring>
+
+#ifdef USE_EPOLL
+#include <unistd.h>
+#endif
+
+namespace LLP
+{
+
+    /** Maximum events to return from a single wait. **/
+    const uint32_t MAX_POLL_EVENTS = 1024;
+
+
+    /* Default Constructor. */
+    Poller::Poller()
+    : POLLER_MUTEX ( )
+    , vWriting     ( )
+#ifdef USE_EPOLL
+    , nEpoll       (epoll_create1(EPOLL_CLOEXEC))
+    , vEvents      (MAX_POLL_EVENTS)
+#else
+    , vPoll        ( )
+#endif
+    {
+#ifdef USE_EPOLL
+        if(nEpoll < 0)
+            debug::error(FUNCTION, "epoll_create1 failed (", errno, " ", strerror(errno), ")");
+#endif
+    }
+
+
+    /* Default Destructor. */
+    Poller::~Poller()
+    {
+#ifdef USE_EPOLL
+        if(nEpoll >= 0)
+            close(nEpoll);
+#endif
+    }
+
+
+    /* Flag to determine if readiness is only reported on state changes. */
+    bool Poller::EdgeTriggered()
+    {
+#ifdef USE_EPOLL
+        return true;
+#else
+        return false;
+#endif
+    }
+
+
+    /* Register a socket for read notifications under given slot. */
+    bool Poller::Add(const SOCKET hSocket, const uint32_t nSlot)
+    {
+        LOCK(POLLER_MUTEX);
+
+        /* Expand our write flags if needed. */
+        if(vWriting.size() <= nSlot)
+            vWriting.resize(nSlot + 1, false);
+
+        vWriting[nSlot] = false;
+
+#ifdef USE_EPOLL
+        epoll_event ev;
+        ev.events   = EPOLLIN | EPOLLRDHUP | EPOLLET;
+        ev.data.u64 = nSlot;
+
+        /* Register with the epoll instance. */
+        if(epoll_ctl(nEpoll, EPOLL_CTL_ADD, hSocket, &ev) < 0)
+            return debug::error(FUNCTION, "epoll_ctl add failed (", errno, " ", strerror(errno), ")");
+#else
+        /* Expand our pollfd set if needed. */
+        if(vPoll.size() <= nSlot)
+        {
+            pollfd fdNull;
+            fdNull.fd      = INVALID_SOCKET;
+            fdNull.events  = 0;
+            fdNull.revents = 0;
+
+            vPoll.resize(nSlot + 1, fdNull);
+        }
+
+        vPoll[nSlot].fd      = hSocket;
+        vPoll[nSlot].events  = POLLIN;
+        vPoll[nSlot].revents = 0;
+#endif
+
+        return true;
+    }
+
+
+    /* Remove a socket from the notification set. */
+    void Poller::Remove(const SOCKET hSocket, const uint32_t nSlot)
+    {
+        LOCK(POLLER_MUTEX);
+
+        if(nSlot < vWriting.size())
+            vWriting[nSlot] = false;
+
+#ifdef USE_EPOLL
+        /* Closed sockets are removed automatically, so errors here are expected. */
+        if(hSocket != INVALID_SOCKET)
+            epoll_ctl(nEpoll, EPOLL_CTL_DEL, hSocket, nullptr);
+#else
+        if(nSlot < vPoll.size())
+            vPoll[nSlot].fd = INVALID_SOCKET;
+#endif
+    }
+
+
+    /* Arm or disarm write notifications for a socket. */
+    void Poller::Write(const SOCKET hSocket, const uint32_t nSlot, const bool fArm)
+    {
+        LOCK(POLLER_MUTEX);
+
+        /* Skip if already in the requested state. */
+        if(nSlot >= vWriting.size() || vWriting[nSlot] == fArm)
+            return;
+
+        vWriting[nSlot] = fArm;
+
+#ifdef USE_EPOLL
+        epoll_event ev;
+        ev.events   = EPOLLIN | EPOLLRDHUP | EPOLLET | (fArm ? static_cast<uint32_t>(EPOLLOUT) : 0u);
+        ev.data.u64 = nSlot;
+
+        epoll_ctl(nEpoll, EPOLL_CTL_MOD, hSocket, &ev);
+#else
+        if(nSlot < vPoll.size())
+            vPoll[nSlot].events = POLLIN | (fArm ? POLLOUT : 0);
+#endif
+    }
+
+
+    /* Wait for sockets to become ready. */
+    int32_t Poller::Wait(std::vector<Event> &vReady, const uint32_t nTimeout)
+    {
+        vReady.clear();
+
+#ifdef USE_EPOLL
+        int32_t nPoll = epoll_wait(nEpoll, &vEvents[0], static_cast<int32_t>(vEvents.size()), nTimeout);
+        if(nPoll < 0)
+            return (errno == EINTR) ? 0 : nPoll;
+
+        /* Translate the epoll events. */
+        vReady.reserve(nPoll);
+        for(int32_t nIndex = 0; nIndex < nPoll; ++nIndex)
+        {
+            const uint32_t nEvents = vEvents[nIndex].events;
+
+            uint8_t nFlags = 0;
+            if(nEvents & EPOLLIN)
+                nFlags |= READABLE;
+
+            if(nEvents & EPOLLOUT)
+                nFlags |= WRITABLE;
+
+            if(nEvents & EPOLLERR)
+                nFlags |= FAILED;
+
+            if(nEvents & EPOLLHUP)
+                nFlags |= HANGUP;
+
+            if(nEvents & EPOLLRDHUP)
+                nFlags |= (CLOSED | READABLE);
+
+            vReady.push_back({static_cast<uint32_t>(vEvents[nIndex].data.u64), nFlags});
+        }
+#else
+        /* Copy our persistent set so registration can continue while we wait. */
+        std::vector<pollfd> vFiles;
+        {
+            LOCK(POLLER_MUTEX);
+            vFiles = vPoll;
+        }
+
+        /* Poll on an empty set to keep consistent sleep times. */
+        if(vFiles.empty())
+        {
+            runtime::sleep(nTimeout);
+            return 0;
+        }
+
+    #ifdef WIN32
+        int32_t nPoll = WSAPoll((pollfd*)&vFiles[0], vFiles.size(), nTimeout);
+    #else
+        int32_t nPoll = poll((pollfd*)&vFiles[0], vFiles.size(), nTimeout);
+    #endif
+
+        if(nPoll <= 0)
+            return nPoll;
+
+        /* Translate the poll events. */
+        for(uint32_t nSlot = 0; nSlot < vFiles.size(); ++nSlot)
+        {
+            const int16_t nEvents = vFiles[nSlot].revents;
+            if(nEvents == 0 || vFiles[nSlot].fd == INVALID_SOCKET)
+                continue;
+
+            uint8_t nFlags = 0;
+            if(nEvents & POLLIN)
+                nFlags |= READABLE;
+
+            if(nEvents & POLLOUT)
+                nFlags |= WRITABLE;
+
+            if(nEvents & (POLLERR | POLLNVAL))
+                nFlags |= FAILED;
+
+            if(nEvents & POLLHUP)
+                nFlags |= HANGUP;
+
+            vReady.push_back({nSlot, nFlags});
+        }
+#endif
+
+        return static_cast<int32_t>(vReady.size());
+    }
+}
@@ -0,0 +1,225 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLP/include/request_pool.h>
+
+#include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+
+#include <algorithm>
+
+namespace LLP
+{
+
+    /* The request workers shared by the API and RPC servers. */
+    std::atomic<RequestPool*> REQUEST_POOL(nullptr);
+
+
+    /** The maximum distinct methods to keep stats for, so bogus method names can't grow the map. **/
+    const uint32_t MAX_METHODS = 256;
+
+
+    /* Constructor */
+    RequestPool::RequestPool(const uint32_t nThreads, const uint32_t nMaxQueueIn, const uint32_t nMaxMethodIn)
+    : QUEUE_MUTEX ( )
+    , CONDITION   ( )
+    , queueJobs   ( )
+    , setStrands  ( )
+    , mapStats    ( )
+    , nMaxQueue   (std::max(nMaxQueueIn, 1u))
+    , nMaxMethod  (std::max(nMaxMethodIn, 1u))
+    , fStop       (false)
+    , vThreads    ( )
+    {
+        for(uint32_t n = 0; n < std::max(nThreads, 1u); ++n)
+            vThreads.push_back(std::thread(std::bind(&RequestPool::Thread, this)));
+    }
+
+
+    /* Destructor */
+    RequestPool::~RequestPool()
+    {
+        Stop();
+    }
+
+
+    /* Stops the workers, dropping any requests that haven't started. */
+    void RequestPool::Stop()
+    {
+        /* Wake up all of our workers. */
+        {
+            LOCK(QUEUE_MUTEX);
+            fStop = true;
+        }
+        CONDITION.notify_all();
+
+        /* Wait for any executing requests to finish. */
+        for(auto& thread : vThreads)
+            if(thread.joinable())
+                thread.join();
+
+        /* Drop the requests that never started. */
+        LOCK(QUEUE_MUTEX);
+        queueJobs.clear();
+    }
+
+
+    /* Queue a request for execution. */
+    bool RequestPool::Submit(const std::string& strMethod, const void* pStrand, const std::function<void()>& fnExecute)
+    {
+        {
+            LOCK(QUEUE_MUTEX);
+
+            /* Apply backpressure when the queue is full or we are stopped. */
+            if(fStop.load() || queueJobs.size() >= nMaxQueue)
+            {
+                ++stats(strMethod).nRejected;
+                return false;
+            }
+
+            /* Build our new job. */
+            Job job;
+            job.strMethod = strMethod;
+            job.pStrand   = pStrand;
+            job.fnExecute = fnExecute;
+            job.timeQueued.Start();
+
+            queueJobs.push_back(std::move(job));
+        }
+        CONDITION.notify_one();
+
+        return true;
+    }
+
+
+    /* Get the total requests waiting in the queue. */
+    uint32_t RequestPool::Pending() const
+    {
+        LOCK(QUEUE_MUTEX);
+        return static_cast<uint32_t>(queueJobs.size());
+    }
+
+
+    /* Get a copy of the stats for each method. */
+    std::map<std::string, RequestPool::Stats> RequestPool::GetStats() const
+    {
+        LOCK(QUEUE_MUTEX);
+        return mapStats;
+    }
+
+
+    /* Worker thread executing queued requests. */
+    void RequestPool::Thread()
+    {
+        while(!fStop.load())
+        {
+            /* Wait for a request we are allowed to run. */
+            Job job;
+            {
+                std::unique_lock<std::mutex> lock(QUEUE_MUTEX);
+                CONDITION.wait(lock, [this, &job]{ return fStop.load() || next(job); });
+
+                /* Check for shutdown. */
+                if(fStop.load())
+                    return;
+            }
+
+            /* Get the time spent waiting in the queue. */
+            const uint64_t nQueueTime = job.timeQueued.ElapsedMicroseconds();
+
+            /* Execute the request. */
+            runtime::timer timeExecute;
+            timeExecute.Start();
+            try
+            {
+                job.fnExecute();
+            }
+            catch(const std::exception& e)
+            {
+                debug::error(FUNCTION, job.strMethod, ": ", e.what());
+            }
+
+            /* Get the time spent executing. */
+            const uint64_t nExecuteTime = timeExecute.ElapsedMicroseconds();
+
+            /* Release our connection and method slot and record our latencies. */
+            {
+                LOCK(QUEUE_MUTEX);
+                setStrands.erase(job.pStrand);
+
+                Stats& stat = stats(job.strMethod);
+                --stat.nActive;
+                ++stat.nCompleted;
+
+                stat.nQueueTime   += nQueueTime;
+                stat.nQueueMax     = std::max(stat.nQueueMax, nQueueTime);
+                stat.nExecuteTime += nExecuteTime;
+                stat.nExecuteMax   = std::max(stat.nExecuteMax, nExecuteTime);
+            }
+
+            /* Requests that were blocked on us may be able to run now. */
+            CONDITION.notify_all();
+        }
+    }
+
+
+    /* Take the oldest request whose method is under its limit and whose connection is idle. */
+    bool RequestPool::next(Job& job)
+    {
+        /* Connections that have an older request still waiting, so we don't reorder their responses. */
+        std::set<const void*> setBlocked;
+
+        /* Scan in arrival order. */
+        for(auto it = queueJobs.begin(); it != queueJobs.end(); ++it)
+        {
+            /* Skip connections that are already busy. */
+            if(setStrands.count(it->pStrand) || setBlocked.count(it->pStrand))
+                continue;
+
+            /* Skip methods that have used up their workers. */
+            Stats& stat = stats(it->strMethod);
+            if(stat.nActive >= nMaxMethod)
+            {
+                setBlocked.insert(it->pStrand);
+                continue;
+            }
+
+            /* Claim the slots for this request. */
+            ++stat.nActive;
+            setStrands.insert(it->pStrand);
+
+            job = std::move(*it);
+            queueJobs.erase(it);
+
+            return true;
+        }
+
+        return false;
+    }
+
+
+    /* Get the stats entry for a method, folding unknown methods together once the map is full. */
+    RequestPool::Stats& RequestPool::stats(const std::string& strMethod)
+    {
+        /* Check for an existing entry. */
+        auto it = mapStats.find(strMethod);
+        if(it != mapStats.end())
+            return it->second;
+
+        /* Fold everything else together once we are full. */
+        if(mapStats.size() >= MAX_METHODS)
+            return mapStats["other"];
+
+        return mapStats[strMethod];
+    }
+}
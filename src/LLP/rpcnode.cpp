@@ -179,11 +179,12 @@ namespace LLP
             if(!config::fInitialized)
                 throw APIException(-1, "Daemon is still initializing");
 
-            /* Execute the RPC method. */
-            json::json jsonResult = TAO::API::RPCCommands->Execute(strMethod, jsonParams, false);
-
-            /* Push the response data with json payload. */
-            PushResponse(200, JSONReply(jsonResult, nullptr, jsonID).dump());
+            /* Execute the RPC method on the request workers. */
+            if(!Dispatch(strMethod, [strMethod, jsonParams, jsonID]
+                {
+                    return Execute(strMethod, jsonParams, jsonID);
+                }))
+                throw APIException(-32000, "Server busy, request queue is full");
         }
 
         /* Handle for custom API exceptions. */
@@ -215,6 +216,47 @@ namespace LLP
     }
 
 
+    /* Execute an RPC method and build the response. */
+    HTTPPacket RPCNode::Execute(const std::string& strMethod, const json::json& jsonParams, const json::json& jsonID)
+    {
+        try
+        {
+            /* Execute the RPC method. */
+            json::json jsonResult = TAO::API::RPCCommands->Execute(strMethod, jsonParams, false);
+
+            /* Build the response with json payload. */
+            HTTPPacket RESPONSE(200);
+            RESPONSE.strContent = JSONReply(jsonResult, nullptr, jsonID).dump();
+
+            return RESPONSE;
+        }
+
+        /* Handle for custom API exceptions. */
+        catch(APIException& e)
+        {
+            debug::error("RPC Exception: ", e.what());
+
+            return ErrorResponse(e.ToJSON(), jsonID);
+        }
+
+        /* Handle for JSON exceptions. */
+        catch(const json::detail::exception& e)
+        {
+            debug::error("RPC Exception: ", e.what());
+
+            return ErrorResponse(APIException(e.id, e.what()).ToJSON(), jsonID);
+        }
+
+        /* Handle for STD exceptions. */
+        catch(const std::exception& e)
+        {
+            debug::error("RPC Exception: ", e.what());
+
+            return ErrorResponse(APIException(-32700, e.what()).ToJSON(), jsonID);
+        }
+    }
+
+
     /* JSON Spec 1.0 Reply including error messages. */
     json::json RPCNode::JSONReply(const json::json& jsonResponse, const json::json& jsonError, const json::json& jsonID)
     {
@@ -238,7 +280,16 @@ namespace LLP
         return jsonReply;
     }
 
+    /* Reply an error from the RPC server. */
     void RPCNode::ErrorReply(const json::json& jsonError, const json::json& jsonID)
+    {
+        /* Send the response packet. */
+        this->WritePacket(ErrorResponse(jsonError, jsonID));
+    }
+
+
+    /* Build an error response for the RPC server. */
+    HTTPPacket RPCNode::ErrorResponse(const json::json& jsonError, const json::json& jsonID)
     {
         /* Default error status code is 500. */
         uint16_t nStatus = 500;
@@ -256,12 +307,20 @@ namespace LLP
             case -32601:
                 nStatus = 404;
                 break;
+
+            case -32000:
+                nStatus = 503;
+                break;
         }
 
-        /* Send the response packet. */
-        PushResponse(nStatus, JSONReply(json::json(nullptr), jsonError, jsonID).dump());
+        /* Build the response packet. */
+        HTTPPacket RESPONSE(nStatus);
+        RESPONSE.strContent = JSONReply(json::json(nullptr), jsonError, jsonID).dump();
+
+        return RESPONSE;
     }
 
+
     bool RPCNode::Authorized(std::map<std::string, std::string>& mapHeaders)
     {
         /* Check the headers. */
@@ -23,6 +23,7 @@ ________________________________________________________________________________
 #ifndef WIN32
 #include <arpa/inet.h>
 #include <sys/ioctl.h>
+#include <sys/uio.h>
 #endif
 
 namespace LLP
@@ -36,7 +37,9 @@ namespace LLP
     , nLastSend          (0)
     , nLastRecv          (0)
     , nError             (0)
-    , vBuffer            ( )
+    , qBuffer            ( )
+    , nBufferOffset      (0)
+    , nBuffered          (0)
     , fBufferFull        (false)
     , nConsecutiveErrors (0)
     , addr               ( )
@@ -57,7 +60,9 @@ namespace LLP
     , nLastSend          (socket.nLastSend.load())
     , nLastRecv          (socket.nLastRecv.load())
     , nError             (socket.nError.load())
-    , vBuffer            (socket.vBuffer)
+    , qBuffer            (socket.qBuffer)
+    , nBufferOffset      (socket.nBufferOffset)
+    , nBuffered          (socket.nBuffered.load())
     , fBufferFull        (socket.fBufferFull.load())
     , nConsecutiveErrors (socket.nConsecutiveErrors.load())
     , addr               (socket.addr)
@@ -73,7 +78,9 @@ namespace LLP
     , nLastSend          (0)
     , nLastRecv          (0)
     , nError             (0)
-    , vBuffer            ( )
+    , qBuffer            ( )
+    , nBufferOffset      (0)
+    , nBuffered          (0)
     , fBufferFull        (false)
     , nConsecutiveErrors (0)
     , addr               (addrIn)
@@ -94,7 +101,9 @@ namespace LLP
     , nLastSend          (0)
     , nLastRecv          (0)
     , nError             (0)
-    , vBuffer            ( )
+    , qBuffer            ( )
+    , nBufferOffset      (0)
+    , nBuffered          (0)
     , fBufferFull        (false)
     , nConsecutiveErrors (0)
     , addr               ( )
@@ -365,44 +374,68 @@ namespace LLP
     /* Write data into the socket buffer non-blocking */
     int32_t Socket::Write(const std::vector<uint8_t>& vData, size_t nBytes)
     {
-        int32_t nSent = 0;
+        /* Don't write past the end of our data. */
+        nBytes = std::min(nBytes, vData.size());
+        if(nBytes == 0)
+            return 0;
+
+        /* Hold the data lock so nothing can be queued between our send and buffering the remainder. */
+        LOCK(DATA_MUTEX);
 
+        /* Check overflow buffer. */
+        if(!qBuffer.empty())
         {
-            LOCK(DATA_MUTEX);
+            qBuffer.push_back(std::make_shared<const std::vector<uint8_t>>(vData.begin(), vData.begin() + nBytes));
+            nBuffered += nBytes;
 
-            /* Check overflow buffer. */
-            if(vBuffer.size() > 0)
-            {
-                vBuffer.insert(vBuffer.end(), vData.begin(), vData.end());
+            return static_cast<int32_t>(nBytes);
+        }
 
-                return static_cast<int32_t>(nBytes);
-            }
+        /* Attempt to send without any buffering. */
+        int32_t nSent = send_direct(&vData[0], nBytes);
+
+        /* Buffer the remaining data if not all data was sent non-blocking. */
+        if(nSent >= 0 && static_cast<size_t>(nSent) != nBytes)
+        {
+            qBuffer.push_back(std::make_shared<const std::vector<uint8_t>>(vData.begin() + nSent, vData.begin() + nBytes));
+            nBuffered += (nBytes - nSent);
         }
 
-        /* If there were any errors, handle them gracefully. */
+        return nSent;
+    }
+
+
+    /* Write a shared buffer into the socket non-blocking. */
+    int32_t Socket::Write(const std::shared_ptr<const std::vector<uint8_t>>& pData)
+    {
+        /* Check for empty data. */
+        if(!pData || pData->empty())
+            return 0;
+
+        /* Hold the data lock so nothing can be queued between our send and buffering the remainder. */
+        LOCK(DATA_MUTEX);
+
+        /* Queue by reference behind existing data. */
+        const size_t nBytes = pData->size();
+        if(!qBuffer.empty())
         {
-            LOCK(SOCKET_MUTEX);
+            qBuffer.push_back(pData);
+            nBuffered += nBytes;
 
-            #ifdef WIN32
-                nSent = static_cast<int32_t>(send(fd, (char*)&vData[0], nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
-            #else
-                nSent = static_cast<int32_t>(send(fd, (int8_t*)&vData[0], nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
-            #endif
+            return static_cast<int32_t>(nBytes);
         }
 
+        /* Attempt to send without any buffering. */
+        int32_t nSent = send_direct(&(*pData)[0], nBytes);
 
-        /* Handle for error state. */
-        if(nSent < 0)
-            nError = WSAGetLastError();
-
-        /* If not all data was sent non-blocking, recurse until it is complete. */
-        else if(nSent != vData.size())
+        /* Queue the shared buffer with an offset for the bytes already sent. */
+        if(nSent >= 0 && static_cast<size_t>(nSent) != nBytes)
         {
-            LOCK(DATA_MUTEX);
-            vBuffer.insert(vBuffer.end(), vData.begin() + nSent, vData.end());
+            qBuffer.push_back(pData);
+            nBufferOffset = nSent;
+
+            nBuffered += (nBytes - nSent);
         }
-        else //don't update last sent unless all the data was written to the buffer
-            nLastSend = runtime::timestamp(true);
 
         return nSent;
     }
@@ -411,32 +444,62 @@ namespace LLP
     /* Flushes data out of the overflow buffer */
     int Socket::Flush()
     {
-        int32_t nSent   = 0;
-        uint32_t nBytes = 0;
-        uint32_t nSize  = 0;
-
-        {
-            LOCK(DATA_MUTEX);
-            nSize = static_cast<uint32_t>(vBuffer.size());
-        }
+        int32_t nSent = 0;
 
         /* Don't flush if buffer doesn't have any data. */
-        if(nSize == 0)
+        if(nBuffered.load() == 0)
             return 0;
 
         /* Set the maximum bytes to flush to 2^16 or maximum socket buffers. */
-        nBytes = std::min(nSize, std::min((uint32_t)config::GetArg("-maxsendsize", 65535u), 65535u));
+        const uint64_t nMaxBytes = std::min((uint32_t)config::GetArg("-maxsendsize", 65535u), 65535u);
 
         /* If there were any errors, handle them gracefully. */
         {
             LOCK2(DATA_MUTEX);
             LOCK(SOCKET_MUTEX);
 
-            #ifdef WIN32
-                nSent = static_cast<int32_t>(send(fd, (char*)&vBuffer[0], nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
-            #else
-                nSent = static_cast<int32_t>(send(fd, (int8_t*)&vBuffer[0], nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
-            #endif
+            /* Check for data again now that we hold the lock. */
+            if(qBuffer.empty())
+                return 0;
+
+        #ifdef WIN32
+            /* Send the front buffer only. */
+            const std::vector<uint8_t>& vFront = *qBuffer.front();
+            const uint64_t nBytes = std::min(vFront.size() - nBufferOffset, nMaxBytes);
+
+            nSent = static_cast<int32_t>(send(fd, (char*)&vFront[nBufferOffset], nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
+        #else
+            /* Gather as many queued buffers as we can into a single send. */
+            struct iovec vBuffers[MAX_SEND_IOV];
+
+            uint32_t nCount = 0;
+            uint64_t nBytes = 0, nOffset = nBufferOffset;
+            for(auto it = qBuffer.begin(); it != qBuffer.end() && nCount < MAX_SEND_IOV && nBytes < nMaxBytes; ++it)
+            {
+                const std::vector<uint8_t>& vData = *(*it);
+                const uint64_t nLength = std::min(vData.size() - nOffset, nMaxBytes - nBytes);
+
+                vBuffers[nCount].iov_base = (void*)&vData[nOffset];
+                vBuffers[nCount].iov_len  = nLength;
+
+                nBytes += nLength;
+                nOffset = 0;
+
+                ++nCount;
+            }
+
+            /* Use sendmsg over writev so we can suppress SIGPIPE. */
+            struct msghdr msg;
+            memset(&msg, 0, sizeof(msg));
+            msg.msg_iov    = vBuffers;
+            msg.msg_iovlen = nCount;
+
+            nSent = static_cast<int32_t>(sendmsg(fd, &msg, MSG_NOSIGNAL | MSG_DONTWAIT));
+        #endif
+
+            /* Remove the sent data from our queue. */
+            if(nSent > 0)
+                consume(nSent);
         }
 
         /* Handle errors on flush. */
@@ -446,14 +509,9 @@ namespace LLP
             ++nConsecutiveErrors;
         }
 
-        /* If not all data was sent non-blocking, recurse until it is complete. */
+        /* Update timers if any data was sent. */
         else if(nSent > 0)
         {
-            LOCK(DATA_MUTEX);
-
-            /* Erase from current buffer. */
-            vBuffer.erase(vBuffer.begin(), vBuffer.begin() + nSent);
-
             /* Update socket timers. */
             nLastSend          = runtime::timestamp(true);
             nConsecutiveErrors = 0;
@@ -485,7 +543,7 @@ namespace LLP
     /* Check that the socket has data that is buffered. */
     uint64_t Socket::Buffered() const
     {
-        return vBuffer.size();
+        return nBuffered.load();
     }
 
 
@@ -524,4 +582,60 @@ namespace LLP
     }
 
 
+    /* Send data straight to the socket when nothing is queued. Must hold DATA_MUTEX. */
+    int32_t Socket::send_direct(const uint8_t* pData, size_t nBytes)
+    {
+        int32_t nSent = 0;
+
+        /* If there were any errors, handle them gracefully. */
+        {
+            LOCK(SOCKET_MUTEX);
+
+            #ifdef WIN32
+                nSent = static_cast<int32_t>(send(fd, (char*)pData, nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
+            #else
+                nSent = static_cast<int32_t>(send(fd, (int8_t*)pData, nBytes, MSG_NOSIGNAL | MSG_DONTWAIT));
+            #endif
+        }
+
+        /* Handle for error state. */
+        if(nSent < 0)
+        {
+            nError = WSAGetLastError();
+
+            /* Treat a full socket buffer as nothing sent so the data is queued. */
+            if(nError == WSAEWOULDBLOCK)
+                nSent = 0;
+        }
+
+        /* Don't update last sent unless all the data was written to the buffer. */
+        else if(static_cast<size_t>(nSent) == nBytes)
+            nLastSend = runtime::timestamp(true);
+
+        return nSent;
+    }
+
+
+    /* Remove sent bytes from the front of the send queue. */
+    void Socket::consume(uint64_t nBytes)
+    {
+        nBuffered -= nBytes;
+
+        /* Pop off any buffers that were completely sent. */
+        while(nBytes > 0 && !qBuffer.empty())
+        {
+            const uint64_t nRemaining = qBuffer.front()->size() - nBufferOffset;
+            if(nBytes < nRemaining)
+            {
+                nBufferOffset += nBytes;
+                return;
+            }
+
+            nBytes -= nRemaining;
+            nBufferOffset = 0;
+
+            qBuffer.pop_front();
+        }
+    }
+
 }
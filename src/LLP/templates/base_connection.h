@@ -174,6 +174,18 @@ namespace LLP
         }
 
 
+        /** Subscriptions
+         *
+         *  Key for the relay filter of this connection. Connections with the same key receive
+         *  identical relays, so data threads only filter and encode a relay once per key.
+         *
+         **/
+        uint64_t Subscriptions() const
+        {
+            return 0; //all connections receive the same relays
+        }
+
+
         /** SetNull
          *
          *  Sets the object to an invalid state.
@@ -227,6 +239,17 @@ namespace LLP
         void WritePacket(const PacketType& PACKET);
 
 
+        /** WritePacket
+         *
+         *  Write an already encoded packet to the TCP stream. The buffer is shared, not copied,
+         *  so the same packet can be written to many connections.
+         *
+         *  @param[in] pBytes The encoded packet bytes.
+         *
+         **/
+        void WritePacket(const std::shared_ptr<const std::vector<uint8_t>>& pBytes);
+
+
         /** ReadPacket
          *
          *  Non-Blocking Packet reader to build a packet from TCP Connection.
@@ -236,6 +259,15 @@ namespace LLP
         virtual void ReadPacket() = 0;
 
 
+        /** PacketPending
+         *
+         *  Checks if data already read from the socket can still be parsed into the packet
+         *  without waiting for more, so edge triggered data threads know to read again.
+         *
+         **/
+        virtual bool PacketPending() const;
+
+
         /** NewMessage
          *
          *  Creates a new message with a commands and data.
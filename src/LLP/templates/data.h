@@ -16,6 +16,8 @@ ________________________________________________________________________________
 #define NEXUS_LLP_TEMPLATES_DATA_H
 
 #include <LLP/include/network.h>
+#include <LLP/include/poller.h>
+#include <LLP/include/timer_wheel.h>
 #include <LLP/include/version.h>
 
 #include <Util/include/mutex.h>
@@ -59,38 +61,6 @@ namespace LLP
     template <class ProtocolType>
     class DataThread
     {
-        /** message_args
-         *
-         *  Overload of variadic templates
-         *
-         *  @param[out] s The data stream to write to
-         *  @param[in] head The object being written
-         *
-         **/
-        template<class Head>
-        void message_args(DataStream& s, Head&& head)
-        {
-            s << std::forward<Head>(head);
-        }
-
-
-        /** message_args
-         *
-         *  Variadic template pack to handle any message size of any type.
-         *
-         *  @param[out] s The data stream to write to
-         *  @param[in] head The object being written
-         *  @param[in] tail The variadic paramters
-         *
-         **/
-        template<class Head, class... Tail>
-        void message_args(DataStream& s, Head&& head, Tail&&... tail)
-        {
-            s << std::forward<Head>(head);
-            message_args(s, std::forward<Tail>(tail)...);
-        }
-
-
         /** Lock access to find slot to ensure no race conditions happend between threads. **/
         std::mutex SLOT_MUTEX;
 
@@ -120,6 +90,14 @@ namespace LLP
         memory::atomic_ptr< std::queue<std::pair<typename ProtocolType::message_t, DataStream>> > RELAY;
 
 
+        /** Persistent readiness notifications for all connections. **/
+        Poller POLLER;
+
+
+        /** Maintenance timers for timeouts, DDOS and generic events. **/
+        TimerWheel TIMERS;
+
+
         /** The condition for thread sleeping. **/
         std::condition_variable CONDITION;
 
@@ -210,10 +188,10 @@ namespace LLP
         void Relay(const MessageType& message, Args&&... args)
         {
             DataStream ssData(SER_NETWORK, MIN_PROTO_VERSION);
-            message_args(ssData, std::forward<Args>(args)...);
+            ssData.Encode(args...);
 
             /* Push the relay message to outbound queue. */
-            RELAY->push(std::make_pair(message, ssData));
+            RELAY->push(std::make_pair(message, std::move(ssData)));
 
             /* Wake up the flush thread. */
             FLUSH_CONDITION.notify_all();
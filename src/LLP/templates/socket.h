@@ -20,7 +20,9 @@ ________________________________________________________________________________
 #include <LLP/include/network.h>
 
 #include <vector>
+#include <deque>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <atomic>
 
@@ -31,6 +33,10 @@ namespace LLP
     const uint64_t MAX_SEND_BUFFER = 3 * 1024 * 1024; //3MB max send buffer
 
 
+    /** Max buffers gathered into a single send. **/
+    const uint32_t MAX_SEND_IOV = 64;
+
+
     /** Socket
      *
      *  Base Template class to handle outgoing / incoming LLP data for both
@@ -62,8 +68,16 @@ namespace LLP
         std::atomic<int32_t> nError;
 
 
-        /** Oversize buffer for large packets. **/
-        std::vector<uint8_t> vBuffer;
+        /** Queue of shared buffers waiting to be sent. Buffers are never modified once queued. **/
+        std::deque< std::shared_ptr<const std::vector<uint8_t>> > qBuffer;
+
+
+        /** Bytes of the front buffer that have already been sent. **/
+        uint64_t nBufferOffset;
+
+
+        /** Total bytes waiting to be sent. **/
+        std::atomic<uint64_t> nBuffered;
 
 
         /** Flag to catch if buffer write failed. **/
@@ -199,6 +213,19 @@ namespace LLP
         int32_t Write(const std::vector<uint8_t>& vData, size_t nBytes);
 
 
+        /** Write
+         *
+         *  Write a shared buffer into the socket non-blocking. Any unsent data is queued
+         *  by reference, so the same buffer can be written to many sockets without copies.
+         *
+         *  @param[in] pData The shared buffer to be written
+         *
+         *  @return the total bytes that were written
+         *
+         **/
+        int32_t Write(const std::shared_ptr<const std::vector<uint8_t>>& pData);
+
+
         /** Flush
          *
          *  Flushes data out of the overflow buffer
@@ -263,6 +290,29 @@ namespace LLP
          **/
         int32_t error_code() const;
 
+
+        /** send_direct
+         *
+         *  Send data straight to the socket when nothing is queued. Must hold DATA_MUTEX.
+         *
+         *  @param[in] pData Pointer to the data to send
+         *  @param[in] nBytes The total bytes to send
+         *
+         *  @return the total bytes that were sent
+         *
+         **/
+        int32_t send_direct(const uint8_t* pData, size_t nBytes);
+
+
+        /** consume
+         *
+         *  Remove sent bytes from the front of the send queue. Must hold DATA_MUTEX.
+         *
+         *  @param[in] nBytes The total bytes that were sent
+         *
+         **/
+        void consume(uint64_t nBytes);
+
     };
 
 }
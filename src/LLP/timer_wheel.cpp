@@ -0,0 +1,111 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLP/include/timer_wheel.h>
+
+#include <Util/include/mutex.h>
+
+#include <algorithm>
+
+namespace LLP
+{
+
+    /* Constructor */
+    TimerWheel::TimerWheel(const uint32_t nResolutionIn, const uint32_t nBuckets)
+    : WHEEL_MUTEX ( )
+    , nResolution (std::max(nResolutionIn, 1u))
+    , nLastTick   (0)
+    , vBuckets    (std::max(nBuckets, 1u))
+    , vDeadlines  ( )
+    {
+    }
+
+
+    /* Set the deadline for a slot, replacing any previous deadline. */
+    void TimerWheel::Schedule(const uint32_t nSlot, const uint64_t nTimestamp)
+    {
+        LOCK(WHEEL_MUTEX);
+
+        /* Round up so we never fire early, and never schedule into the past. */
+        uint64_t nTick = std::max((nTimestamp + nResolution - 1) / nResolution, nLastTick + 1);
+
+        /* Expand our deadlines if needed. */
+        if(vDeadlines.size() <= nSlot)
+            vDeadlines.resize(nSlot + 1, 0);
+
+        /* Any previous entry for this slot becomes stale when the deadline changes. */
+        vDeadlines[nSlot] = nTick;
+        vBuckets[nTick % vBuckets.size()].push_back(std::make_pair(nSlot, nTick));
+    }
+
+
+    /* Clear any pending deadline for a slot. */
+    void TimerWheel::Cancel(const uint32_t nSlot)
+    {
+        LOCK(WHEEL_MUTEX);
+
+        if(nSlot < vDeadlines.size())
+            vDeadlines[nSlot] = 0;
+    }
+
+
+    /* Collect all slots whose deadline has passed. */
+    void TimerWheel::Expire(const uint64_t nTimestamp, std::vector<uint32_t> &vExpired)
+    {
+        vExpired.clear();
+
+        LOCK(WHEEL_MUTEX);
+
+        /* Initialize our starting tick on first use. */
+        const uint64_t nTick = nTimestamp / nResolution;
+        if(nLastTick == 0)
+            nLastTick = nTick - 1;
+
+        /* Nothing to do until the next tick. */
+        if(nTick <= nLastTick)
+            return;
+
+        /* Only walk each bucket once even if we fell behind by a full rotation. */
+        const uint64_t nElapsed = std::min(nTick - nLastTick, static_cast<uint64_t>(vBuckets.size()));
+        for(uint64_t nCurrent = nTick - nElapsed + 1; nCurrent <= nTick; ++nCurrent)
+        {
+            std::vector< std::pair<uint32_t, uint64_t> >& vBucket = vBuckets[nCurrent % vBuckets.size()];
+
+            /* Keep entries for later rotations, drop stale ones. */
+            uint32_t nKeep = 0;
+            for(uint32_t nIndex = 0; nIndex < vBucket.size(); ++nIndex)
+            {
+                const uint32_t nSlot     = vBucket[nIndex].first;
+                const uint64_t nDeadline = vBucket[nIndex].second;
+
+                /* Check that this is still the active deadline for this slot. */
+                if(nSlot >= vDeadlines.size() || vDeadlines[nSlot] != nDeadline)
+                    continue;
+
+                /* Check for a deadline further out than one rotation. */
+                if(nDeadline > nTick)
+                {
+                    vBucket[nKeep++] = vBucket[nIndex];
+                    continue;
+                }
+
+                vDeadlines[nSlot] = 0;
+                vExpired.push_back(nSlot);
+            }
+
+            vBucket.resize(nKeep);
+        }
+
+        nLastTick = nTick;
+    }
+}
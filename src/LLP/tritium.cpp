@@ -2652,6 +2652,13 @@ namespace LLP
     }
 
 
+    /* Key for the relay filter of this node, which only depends on its notifications. */
+    uint64_t TritiumNode::Subscriptions() const
+    {
+        return nNotifications;
+    }
+
+
     /* Determine whether a session is connected. */
     bool TritiumNode::SessionActive(const uint64_t nSession)
     {
@@ -94,6 +94,38 @@ namespace LLP
          **/
         bool Authorized(std::map<std::string, std::string>& mapHeaders);
 
+
+    private:
+
+        /** Execute
+         *
+         *  Execute an API method and build the response. This runs on the request workers,
+         *  so it must not touch the node.
+         *
+         *  @param[in] strAPI The API to execute on.
+         *  @param[in] strMethod The method to execute.
+         *  @param[in] params The parameters for the method.
+         *  @param[in] strOrigin The origin header of the request, empty if none.
+         *
+         *  @return The response packet.
+         *
+         **/
+        static HTTPPacket Execute(const std::string& strAPI, const std::string& strMethod,
+                                  const json::json& params, const std::string& strOrigin);
+
+
+        /** ErrorResponse
+         *
+         *  Build an error response for an API exception.
+         *
+         *  @param[in] jsonError The error json from the exception.
+         *  @param[in] strOrigin The origin header of the request, empty if none.
+         *
+         *  @return The response packet.
+         *
+         **/
+        static HTTPPacket ErrorResponse(const json::json& jsonError, const std::string& strOrigin);
+
     };
 }
 
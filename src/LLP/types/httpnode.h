@@ -18,9 +18,12 @@ ________________________________________________________________________________
 #include <LLP/templates/base_connection.h>
 #include <LLP/packets/http.h>
 
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <string>
 #include <vector>
-#include <cstdint>
 
 
 #define HTTPNODE ANSI_COLOR_FUNCTION "HTTPNode" ANSI_COLOR_RESET " : "
@@ -28,6 +31,61 @@ ________________________________________________________________________________
 namespace LLP
 {
 
+    /* Forward declarations. */
+    class HTTPNode;
+
+
+    /** Responder
+     *
+     *  Handle used by request workers to post a response back to the node that queued it.
+     *  The node releases the handle when it is destroyed, so late responses are dropped.
+     *
+     **/
+    class Responder
+    {
+        /** Mutex to keep the node alive while a response is written. **/
+        std::mutex RESPONDER_MUTEX;
+
+
+        /** The node to respond to, nullptr once released. **/
+        HTTPNode* pNode;
+
+    public:
+
+        /** Constructor **/
+        Responder(HTTPNode* pNodeIn);
+
+
+        /** Release
+         *
+         *  Detach from the node, waiting for any response in progress.
+         *
+         **/
+        void Release();
+
+
+        /** Active
+         *
+         *  Check if the node is still connected and waiting for a response.
+         *
+         **/
+        bool Active();
+
+
+        /** Respond
+         *
+         *  Write a response packet to the node if it is still connected.
+         *
+         *  @param[in] RESPONSE The response packet to write.
+         *
+         *  @return true if the response was written.
+         *
+         **/
+        bool Respond(const HTTPPacket& RESPONSE);
+
+    };
+
+
     /** HTTPNode
      *
      *  A node that can speak over HTTP protocols.
@@ -52,6 +110,10 @@ namespace LLP
         /* Internal Read Buffer. */
         std::vector<int8_t> vchBuffer;
 
+
+        /* Handle for request workers to respond to this node. */
+        std::shared_ptr<Responder> pResponder;
+
     public:
 
         /** Default Constructor **/
@@ -111,6 +173,14 @@ namespace LLP
         void ReadPacket() final;
 
 
+        /** PacketPending
+         *
+         *  Checks if the read buffer still holds header lines or content to parse.
+         *
+         **/
+        bool PacketPending() const final;
+
+
         /** PushResponse
          *
          *  Returns an HTTP packet with response code and content.
@@ -122,6 +192,20 @@ namespace LLP
          **/
         void PushResponse(const uint16_t nMsg, const std::string& strContent);
 
+
+        /** Dispatch
+         *
+         *  Queue a request to execute on the request workers, posting the response back to this
+         *  node when it completes. Executes inline if there are no request workers.
+         *
+         *  @param[in] strMethod The method name used for limits and stats.
+         *  @param[in] fnExecute The work to execute, returning the response packet.
+         *
+         *  @return true if queued or executed, false if the request queue is full.
+         *
+         **/
+        bool Dispatch(const std::string& strMethod, const std::function<HTTPPacket()>& fnExecute);
+
     };
 
 }
@@ -18,6 +18,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/types/block.h>
 #include <Legacy/types/coinbase.h>
 #include <atomic>
+#include <unordered_map>
 
 namespace Legacy
 {
@@ -92,14 +93,18 @@ namespace LLP
         std::mutex MUTEX;
 
 
-        /** The map to hold the list of blocks that are being mined. */
-        std::map<uint512_t, TAO::Ledger::Block *> mapBlocks;
+        /** The map to hold the list of blocks that are being mined, keyed by merkle root for constant time submits. */
+        std::unordered_map<uint512_t, TAO::Ledger::Block *> mapBlocks;
 
 
         /** The current best block. **/
         std::atomic<uint32_t> nBestHeight;
 
 
+        /** The best chain hash the current round is mined on. **/
+        uint1024_t hashBestChain;
+
+
         /* Subscribe to display how many blocks connection subscribed to */
         std::atomic<uint32_t> nSubscribed;
 
@@ -122,7 +127,15 @@ namespace LLP
 
 
         /** Used as an ID iterator for generating unique hashes from same block transactions. **/
-        static std::atomic<uint32_t> nBlockIterator;
+        uint32_t nBlockIterator;
+
+
+        /** The id of this connection, used as the high bits of its extra nonces so no two connections mine the same block. **/
+        uint32_t nMinerID;
+
+
+        /** Used as an ID iterator for giving each connection its own miner id. **/
+        static std::atomic<uint32_t> nMinerIterator;
 
     public:
 
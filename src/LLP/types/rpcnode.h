@@ -91,7 +91,7 @@ namespace LLP
          *  @return The json object to respond with.
          *
          **/
-        json::json JSONReply(const json::json& jsonResponse, const json::json& jsonError, const json::json& jsonID);
+        static json::json JSONReply(const json::json& jsonResponse, const json::json& jsonError, const json::json& jsonID);
 
 
         /** ErrorReply
@@ -106,6 +106,34 @@ namespace LLP
         void ErrorReply(const json::json& jsonError, const json::json& jsonID);
 
 
+        /** ErrorResponse
+         *
+         *  Build an error response packet for the RPC server.
+         *
+         *  @param[in] jsonError The JSON error response object.
+         *  @param[in] jsonID The identifier of request.
+         *
+         *  @return The response packet.
+         *
+         **/
+        static HTTPPacket ErrorResponse(const json::json& jsonError, const json::json& jsonID);
+
+
+        /** Execute
+         *
+         *  Execute an RPC method and build the response. This runs on the request workers,
+         *  so it must not touch the node.
+         *
+         *  @param[in] strMethod The method to execute.
+         *  @param[in] jsonParams The parameters for the method.
+         *  @param[in] jsonID The identifier of request.
+         *
+         *  @return The response packet.
+         *
+         **/
+        static HTTPPacket Execute(const std::string& strMethod, const json::json& jsonParams, const json::json& jsonID);
+
+
         /** Authorized
          *
          *  Check if an authorization base64 encoded string is correct.
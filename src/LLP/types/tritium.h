@@ -142,38 +142,6 @@ namespace LLP
         static void SwitchNode();
 
 
-        /** message_args
-         *
-         *  Overload of variadic templates
-         *
-         *  @param[out] s The data stream to write to
-         *  @param[in] head The object being written
-         *
-         **/
-        template<class Head>
-        void message_args(DataStream& s, Head&& head)
-        {
-            s << std::forward<Head>(head);
-        }
-
-
-        /** message_args
-         *
-         *  Variadic template pack to handle any message size of any type.
-         *
-         *  @param[out] s The data stream to write to
-         *  @param[in] head The object being written
-         *  @param[in] tail The variadic paramters
-         *
-         **/
-        template<class Head, class... Tail>
-        void message_args(DataStream& s, Head&& head, Tail&&... tail)
-        {
-            s << std::forward<Head>(head);
-            message_args(s, std::forward<Tail>(tail)...);
-        }
-
-
         /** State of if node has currently verified signature. **/
         std::atomic<bool> fAuthorized;
 
@@ -373,6 +341,16 @@ namespace LLP
         const DataStream Notifications(const uint16_t nMsg, const DataStream& ssData) const;
 
 
+        /** Subscriptions
+         *
+         *  Key for the relay filter of this node, which only depends on its notifications.
+         *
+         *  @return the current notification flags
+         *
+         **/
+        uint64_t Subscriptions() const;
+
+
         /** Auth
          *
          *  Authorize this node to the connected node .
@@ -459,11 +437,16 @@ namespace LLP
         void PushMessage(const uint16_t nMsg, Args&&... args)
         {
             DataStream ssData(SER_NETWORK, MIN_PROTO_VERSION);
-            message_args(ssData, std::forward<Args>(args)...);
+            ssData.Encode(args...);
 
-            WritePacket(NewMessage(nMsg, ssData));
+            /* Hand the encoded bytes to the packet rather than copying them. */
+            const uint64_t nSize = ssData.size();
+
+            TritiumPacket RESPONSE(nMsg);
+            RESPONSE.SetData(std::move(ssData));
+            WritePacket(RESPONSE);
 
-            debug::log(4, NODE, "sent message ", std::hex, nMsg, " of ", std::dec, ssData.size(), " bytes");
+            debug::log(4, NODE, "sent message ", std::hex, nMsg, " of ", std::dec, nSize, " bytes");
         }
 
     };
@@ -38,7 +38,7 @@ namespace Legacy
     , dbenv(nullptr)
     , pdb(nullptr)
     , strDbFile(strFileIn)
-    , vTxn()
+    , mapTxn()
     {
         /* Passing an empty string is invalid */
         if(strFileIn.empty())
@@ -245,11 +245,15 @@ namespace Legacy
         if(pdb == nullptr)
             return;
 
-        /* Abort any in-progress transactions on this database */
-        if(!vTxn.empty())
-            vTxn.front()->abort();
+        /* Abort any in-progress transactions on this database, aborting a parent aborts its children */
+        for(auto& txns : mapTxn)
+        {
+            if(!txns.second.empty())
+                txns.second.front()->abort();
+        }
 
-        vTxn.clear();
+        mapTxn.clear();
+        condTxn.notify_all();
 
         /* Flush database activity from memory pool to disk log */
         uint32_t nMinutes = 0;
@@ -267,13 +271,25 @@ namespace Legacy
     /*  Retrieves the most recently started database transaction. */
     DbTxn* BerkeleyDB::GetTxn()
     {
-        if(!vTxn.empty())
-            return vTxn.back();
+        auto it = mapTxn.find(std::this_thread::get_id());
+        if(it != mapTxn.end() && !it->second.empty())
+            return it->second.back();
         else
             return nullptr;
     }
 
 
+    /* Wait until no other thread has a transaction open. */
+    void BerkeleyDB::WaitTxn(std::unique_lock<std::mutex>& lock)
+    {
+        const std::thread::id nThread = std::this_thread::get_id();
+        condTxn.wait(lock, [this, nThread]
+        {
+            return mapTxn.empty() || (mapTxn.size() == 1 && mapTxn.count(nThread));
+        });
+    }
+
+
     /* Public Methods */
 
     /* Open a cursor at the beginning of the database. */
@@ -366,10 +382,11 @@ namespace Legacy
     }
 
 
-    /* Start a new database transaction and add it to vTxn */
+    /* Start a new database transaction on the calling thread */
     bool BerkeleyDB::TxnBegin()
     {
-        LOCK(cs_db);
+        std::unique_lock<std::mutex> lock(cs_db);
+        WaitTxn(lock);
 
         if(pdb == nullptr)
             OpenHandle();
@@ -383,14 +400,14 @@ namespace Legacy
         if(pTxn == nullptr || ret != 0)
             return false;
 
-        /* Add new transaction to the end of vTxn */
-        vTxn.push_back(pTxn);
+        /* Add new transaction to the end of this thread's transactions */
+        mapTxn[std::this_thread::get_id()].push_back(pTxn);
 
         return true;
     }
 
 
-    /* Commit the transaction most recently added to vTxn */
+    /* Commit the transaction most recently started on the calling thread */
     bool BerkeleyDB::TxnCommit()
     {
         LOCK(cs_db);
@@ -402,13 +419,20 @@ namespace Legacy
 
         int32_t ret = pTxn->commit(0);
 
+        /* Remove it from this thread's transactions */
+        std::vector<DbTxn*>& vTxn = mapTxn[std::this_thread::get_id()];
         vTxn.pop_back();
+        if(vTxn.empty())
+        {
+            mapTxn.erase(std::this_thread::get_id());
+            condTxn.notify_all();
+        }
 
         return (ret == 0);
     }
 
 
-    /* Abort the transaction most recently added to vTxn, reversing any updates performed. */
+    /* Abort the transaction most recently started on the calling thread, reversing any updates performed. */
     bool BerkeleyDB::TxnAbort()
     {
         LOCK(cs_db);
@@ -420,7 +444,14 @@ namespace Legacy
 
         int32_t ret = pTxn->abort();
 
+        /* Remove it from this thread's transactions */
+        std::vector<DbTxn*>& vTxn = mapTxn[std::this_thread::get_id()];
         vTxn.pop_back();
+        if(vTxn.empty())
+        {
+            mapTxn.erase(std::this_thread::get_id());
+            condTxn.notify_all();
+        }
 
         return (ret == 0);
     }
@@ -72,6 +72,10 @@ namespace Legacy
             }
 
 
+            /* Write the whole new pool in one database transaction, locking the wallet first as its other writers wait on the batch. */
+            RLOCK(poolWallet.cs_wallet);
+            WalletBatch batch(walletdb);
+
             for(uint64_t nPoolIndex : vPoolIndexList)
                 walletdb.ErasePool(nPoolIndex);
 
@@ -95,6 +99,9 @@ namespace Legacy
                     throw std::runtime_error("KeyPool::NewKeyPool() : writing generated key failed");
             }
 
+            if(batch.Active() && !batch.Commit())
+                throw std::runtime_error("KeyPool::NewKeyPool() : committing generated keys failed");
+
             debug::log(2, FUNCTION, "Added ", nKeys, " new keys to key pool");
         }
 
@@ -140,7 +147,7 @@ namespace Legacy
                 /* New pool indexes will begin from the current max */
                 uint64_t nNewPoolIndex = nCurrentMaxPoolIndex;
 
-                vPoolIndexList.resize(nTargetSize - nStartingSize);
+                vPoolIndexList.reserve(nTargetSize - nStartingSize);
 
                 /* Top up key pool */
                 for(uint64_t i = (nStartingSize + 1); i <= nTargetSize; ++i)
@@ -155,13 +162,19 @@ namespace Legacy
                 }
             }
 
-            /* Write keys to database using list of indexes added to pool */
+            /* Write keys to database using list of indexes added to pool, in one database transaction.
+             * Lock the wallet first, as its other writers wait on the batch. */
+            RLOCK(poolWallet.cs_wallet);
+            WalletBatch batch(walletdb);
             for(uint64_t nPoolIndex : vPoolIndexList)
             {
                 if(!walletdb.WritePool(nPoolIndex, KeyPoolEntry(poolWallet.GenerateNewKey())))
-                    throw std::runtime_error("KeyPool::NewKeyPool() : writing generated key failed");
+                    throw std::runtime_error("KeyPool::TopUpKeyPool() : writing generated key failed");
             }
 
+            if(batch.Active() && !batch.Commit())
+                throw std::runtime_error("KeyPool::TopUpKeyPool() : committing generated keys failed");
+
             if(fKeysAdded)
                 debug::log(2, FUNCTION, "Keypool topped up, ", (nTargetSize - nStartingSize), " keys added, new size = ",  nTargetSize);
         }
@@ -13,6 +13,7 @@ ________________________________________________________________________________
 
 #include <cmath>
 
+#include <LLC/hash/writer.h>
 #include <LLC/include/eckey.h>
 
 #include <Legacy/types/legacy.h>
@@ -729,24 +730,22 @@ namespace Legacy
         /* Signature hash for version 7 blocks. */
         if(nVersion >= 7)
         {
-            /* Create a data stream to get the hash. */
-            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-            ss.reserve(256);
+            /* Create a hash writer to get the hash. */
+            LLC::SKHashWriter<1024> ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
 
             /* Serialize the data to hash into a stream. */
             ss << nVersion << hashPrevBlock << hashMerkleRoot << nChannel << nHeight << nBits << nNonce << nTime << vOffsets;
 
-            return LLC::SK1024(ss.begin(), ss.end());
+            return ss.GetHash();
         }
 
-        /* Create a data stream to get the hash. */
-        DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-        ss.reserve(256);
+        /* Create a hash writer to get the hash. */
+        LLC::SKHashWriter<1024> ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
 
         /* Serialize the data to hash into a stream. */
         ss << nVersion << hashPrevBlock << hashMerkleRoot << nChannel << nHeight << nBits << nNonce << uint32_t(nTime);
 
-        return LLC::SK1024(ss.begin(), ss.end());
+        return ss.GetHash();
     }
 
 
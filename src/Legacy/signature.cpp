@@ -13,6 +13,7 @@ ________________________________________________________________________________
 
 #include <LLC/types/bignum.h>
 #include <LLC/hash/SK.h>
+#include <LLC/hash/writer.h>
 
 #include <Legacy/include/enum.h>
 #include <Legacy/include/evaluate.h>
@@ -132,11 +133,10 @@ namespace Legacy
         }
 
         // Serialize and hash
-        DataStream ss(SER_GETHASH, 0);
-        ss.reserve(8192);
+        LLC::SKHashWriter<256> ss(SER_GETHASH, 0);
         ss << txTmp << nHashType;
 
-        return LLC::SK256(ss.begin(), ss.end());
+        return ss.GetHash();
     }
 
 
@@ -12,6 +12,7 @@
 ____________________________________________________________________________________________*/
 
 #include <LLC/hash/SK.h>
+#include <LLC/hash/writer.h>
 
 #include <LLP/include/version.h>
 
@@ -116,13 +117,10 @@ namespace Legacy
 	/* Get the hash of the object. */
 	uint512_t TxOut::GetHash() const
 	{
-		// Most of the time is spent allocating and deallocating DataStream's
-	    // buffer.  If this ever needs to be optimized further, make a CStaticStream
-	    // class with its buffer on the stack.
-	    DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-	    ss.reserve(8192);
+		/* Hash the serialized output without buffering it. */
+	    LLC::SKHashWriter<512> ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
 	    ss << *this;
-	    return LLC::SK512(ss.begin(), ss.end());
+	    return ss.GetHash();
 	}
 
 
@@ -162,4 +162,18 @@ namespace Legacy
 	};
 }
 
+
+/* Custom hash function to allow outpoints to key unordered containers. */
+namespace std
+{
+	template<>
+	struct hash<Legacy::OutPoint>
+	{
+		size_t operator()(const Legacy::OutPoint& out) const
+		{
+			return static_cast<size_t>(hash<uint512_t>()(out.hash) ^ (out.n * 0x9e3779b97f4a7c15));
+		}
+	};
+}
+
 #endif
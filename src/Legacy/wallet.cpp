@@ -84,6 +84,8 @@ namespace Legacy
     , vchDefaultKey     ( )
     , vchTrustKey       ( )
     , nWalletUnlockTime (0)
+    , setUnspent        ( )
+    , fUnspentStale     (true)
     , cs_wallet         ( )
     , mapWallet         ( )
     {
@@ -204,6 +206,9 @@ namespace Legacy
 
             if(nLoadWalletRet != DB_LOAD_OK)
                 return nLoadWalletRet;
+
+            /* Transactions were loaded straight into mapWallet, so index them all on next use. */
+            fUnspentStale = true;
         }
 
         /* New wallet is indicated by an empty default key */
@@ -337,6 +342,9 @@ namespace Legacy
             if(!CryptoKeyStore::AddScript(redeemScript))
                 return false;
 
+            /* Existing outputs to this script are now ours. */
+            fUnspentStale = true;
+
             if(fFileBacked)
             {
                 WalletDB walletdb(strWalletFile);
@@ -720,9 +728,9 @@ namespace Legacy
              */
             RLOCK(cs_wallet);
 
-            for (const auto& item : mapWallet)
+            for(const auto& it : GetUnspent())
             {
-                const WalletTx& wtx = item.second;
+                const WalletTx& wtx = it->second;
 
                 /* Skip any transaction that isn't final, isn't completely confirmed, or has a future timestamp */
                 if (!wtx.IsFinal() || !wtx.IsConfirmed() || wtx.nTime > runtime::unifiedtimestamp())
@@ -745,9 +753,9 @@ namespace Legacy
         {
             RLOCK(cs_wallet);
             nBalance = 0;
-            for(auto it = mapWallet.begin(); it != mapWallet.end(); ++it)
+            for(const auto& it : GetUnspent())
             {
-                const WalletTx* pcoin = &(*it).second;
+                const WalletTx* pcoin = &it->second;
                 if(!pcoin->IsFinal())
                     continue;
 
@@ -807,9 +815,9 @@ namespace Legacy
              */
             RLOCK(cs_wallet);
 
-            for (const auto& item : mapWallet)
+            for(const auto& it : GetUnspent())
             {
-                const WalletTx& wtx = item.second;
+                const WalletTx& wtx = it->second;
 
                 if (wtx.IsFinal() && wtx.IsConfirmed())
                     continue;
@@ -875,9 +883,9 @@ namespace Legacy
 
             vCoins.clear();
 
-            for(const auto& item : mapWallet)
+            for(const auto& it : GetUnspent())
             {
-                const WalletTx& wtx = item.second;
+                const WalletTx& wtx = it->second;
 
                 /* Filter transactions not final */
                 if (!wtx.IsFinal())
@@ -918,6 +926,9 @@ namespace Legacy
 
             for(auto& item : mapWallet)
                 item.second.MarkDirty();
+
+            /* Balances are recalculated after key changes, so reindex which outputs are ours. */
+            fUnspentStale = true;
         }
     }
 
@@ -956,6 +967,9 @@ namespace Legacy
 
             /* Inserts only if not already there, returns tx inserted or tx found */
             ret = mapWallet.insert(std::make_pair(hash, wtxIn));
+
+            /* New or updated transactions may have unspent outputs. */
+            setUnspent.insert(hash);
         }
 
         WalletTx& wtx = (*ret.first).second;
@@ -1149,6 +1163,7 @@ namespace Legacy
         {
             RLOCK(cs_wallet);
 
+            setUnspent.erase(hash);
             if(mapWallet.erase(hash))
             {
                 WalletDB walletdb(strWalletFile);
@@ -1186,6 +1201,8 @@ namespace Legacy
                     {
                         txPrev.MarkUnspent(txin.prevout.n);
                         txPrev.WriteToDisk(tx.GetHash());
+
+                        setUnspent.insert(txin.prevout.hash);
                     }
                 }
             }
@@ -1259,6 +1276,12 @@ namespace Legacy
                 if(!LLD::Legacy->BatchRead(std::make_pair(std::string("tx"), hashLast), "tx", vtx, 1000, !fFirst))
                     break;
 
+                /* Write the wallet updates for each batch of inventory in one database transaction.
+                 * The wallet is locked first, as other writers to the wallet file wait for the batch to end. */
+                RLOCK(cs_wallet);
+                WalletDB walletdb(strWalletFile);
+                WalletBatch batch(walletdb, fFileBacked);
+
                 /* Loop through found transactions. */
                 TAO::Ledger::BlockState state;
                 for(const auto& tx : vtx)
@@ -1298,6 +1321,11 @@ namespace Legacy
                     }
                 }
 
+                /* Commit this batch of wallet updates. If that fails the wallet file no longer matches the wallet in
+                 * memory, so stop here rather than carry on as if the rescan had succeeded. */
+                if(batch.Active() && !batch.Commit())
+                    return debug::error(FUNCTION, "Failed to commit rescan batch, wallet file is missing updates, rescan again");
+
                 /* Set hash Last. */
                 hashLast = vtx.back().GetHash();
 
@@ -1347,6 +1375,12 @@ namespace Legacy
                 if(!LLD::Ledger->BatchRead(hashLast, "tx", vtx, 1000, !fFirst))
                     break;
 
+                /* Write the wallet updates for each batch of inventory in one database transaction.
+                 * The wallet is locked first, as other writers to the wallet file wait for the batch to end. */
+                RLOCK(cs_wallet);
+                WalletDB walletdb(strWalletFile);
+                WalletBatch batch(walletdb, fFileBacked);
+
                 /* Loop through found transactions. */
                 TAO::Ledger::BlockState state;
                 for(const auto& tx : vtx)
@@ -1386,6 +1420,11 @@ namespace Legacy
                     }
                 }
 
+                /* Commit this batch of wallet updates. If that fails the wallet file no longer matches the wallet in
+                 * memory, so stop here rather than carry on as if the rescan had succeeded. */
+                if(batch.Active() && !batch.Commit())
+                    return debug::error(FUNCTION, "Failed to commit rescan batch, wallet file is missing updates, rescan again");
+
                 /* Set hash Last. */
                 hashLast = vtx.back().GetHash();
 
@@ -1588,7 +1627,10 @@ namespace Legacy
 
             /* Update mapWallet with repaired transactions */
             for (const auto& map : mapRepaired)
+            {
                 mapWallet[map.first] = map.second;
+                setUnspent.insert(map.first);
+            }
         }
     }
 
@@ -2131,23 +2173,19 @@ namespace Legacy
 
         const uint32_t nMinimumCoinAge = (config::fTestNet ? TAO::Ledger::MINIMUM_GENESIS_COIN_AGE_TESTNET : TAO::Ledger::MINIMUM_GENESIS_COIN_AGE);
 
-        /* Keep a local list of wallet pointers. */
-        std::vector<uint512_t> vCoins;
-
-        /* Build a set of wallet transactions from all transaction in the wallet map */
-        vCoins.reserve(mapWallet.size());
-        for (const auto& item : mapWallet)
-            vCoins.push_back(item.first);
+        /* Build a set of wallet transactions from those with unspent outputs */
+        std::vector<TransactionMap::const_iterator> vCoins = GetUnspent();
 
         /* Randomly order the transactions as potential inputs */
         std::random_shuffle(vCoins.begin(), vCoins.end(), LLC::GetRandInt);
 
         /* Add Each Input to Transaction. */
         std::vector<const WalletTx*> vInputs;
-        for(const uint512_t& hash : vCoins)
+        for(const auto& it : vCoins)
         {
             /* Get a reference from wallet map. */
-            const WalletTx* wtx = &mapWallet[hash];
+            const uint512_t& hash = it->first;
+            const WalletTx* wtx = &it->second;
 
             /* Can't spend balance that is unconfirmed or not final */
             if (!wtx->IsFinal() || !wtx->IsConfirmed())
@@ -2259,6 +2297,53 @@ namespace Legacy
     }
 
 
+    /* Gets the wallet transactions that still have unspent outputs belonging to this wallet. */
+    std::vector<TransactionMap::const_iterator> Wallet::GetUnspent()
+    {
+        /* Rebuild from every transaction when keys may have changed what is ours. */
+        if(fUnspentStale)
+        {
+            setUnspent.clear();
+            for(const auto& item : mapWallet)
+                setUnspent.insert(setUnspent.end(), item.first);
+
+            fUnspentStale = false;
+        }
+
+        std::vector<TransactionMap::const_iterator> vUnspent;
+        vUnspent.reserve(setUnspent.size());
+
+        /* Walk the index, dropping transactions that are gone or have nothing left for us to spend. */
+        for(auto it = setUnspent.begin(); it != setUnspent.end(); )
+        {
+            TransactionMap::const_iterator mi = mapWallet.find(*it);
+            if(mi == mapWallet.end())
+            {
+                it = setUnspent.erase(it);
+                continue;
+            }
+
+            /* Check for any unspent output of ours. */
+            const WalletTx& wtx = mi->second;
+
+            bool fUnspent = false;
+            for(uint32_t i = 0; i < wtx.vout.size() && !fUnspent; ++i)
+                fUnspent = (!wtx.IsSpent(i) && IsMine(wtx.vout[i]));
+
+            if(!fUnspent)
+            {
+                it = setUnspent.erase(it);
+                continue;
+            }
+
+            vUnspent.push_back(mi);
+            ++it;
+        }
+
+        return vUnspent;
+    }
+
+
     /* Selects the unspent transaction outputs to use as inputs when creating a transaction that sends balance from this wallet. */
     bool Wallet::SelectCoins(const int64_t nTargetValue, const uint32_t nSpendTime,
         std::map<std::pair<uint512_t, uint32_t>, const WalletTx*>& mapCoinsRet,
@@ -2284,26 +2369,24 @@ namespace Legacy
     {
         /* cs_wallet should already be locked when this is called (CreateTransaction) */
         mapCoinsRet.clear();
-        std::vector<uint512_t> vCoins;
 
         nValueRet = 0;
 
         if(config::GetBoolArg("-printselectcoin", false))
             debug::log(0, FUNCTION, "Selecting coins for account ", strAccount);
 
-        /* Build a set of wallet transactions from all transaction in the wallet map */
-        vCoins.reserve(mapWallet.size());
-        for(const auto& item : mapWallet)
-            vCoins.push_back(item.first);
+        /* Build a set of wallet transactions from those with unspent outputs */
+        std::vector<TransactionMap::const_iterator> vCoins = GetUnspent();
 
         /* Randomly order the transactions as potential inputs */
         std::random_shuffle(vCoins.begin(), vCoins.end(), LLC::GetRandInt);
 
         /* Loop through all transactions, finding and adding available unspent balance to the list of outputs until reach nTargetValue */
-        for(const uint512_t& hash : vCoins)
+        for(const auto& it : vCoins)
         {
             /* Get the transaction. */
-            const WalletTx* wtx = &mapWallet[hash];
+            const uint512_t& hash = it->first;
+            const WalletTx* wtx = &it->second;
 
             /* Can't spend transaction from after spend time */
             if(wtx->nTime > nSpendTime)
@@ -22,9 +22,11 @@ ________________________________________________________________________________
 #include <db_cxx.h> /* Berkeley DB header */
 
 #include <atomic>
+#include <condition_variable>
 #include <map>
 #include <mutex>
 #include <string>
+#include <thread>
 #include <vector>
 
 
@@ -82,8 +84,13 @@ namespace Legacy
         std::string strDbFile;
 
 
-        /** Contains all current open (uncommitted) transactions for the database in the order they were begun **/
-        std::vector<DbTxn*> vTxn;
+        /** Contains all current open (uncommitted) transactions for the database by thread, in the order they were begun.
+         *  Each thread only reads and writes through its own transactions. **/
+        std::map<std::thread::id, std::vector<DbTxn*> > mapTxn;
+
+
+        /** Signalled when a thread ends its last open transaction, waking writers waiting on it. **/
+        std::condition_variable condTxn;
 
 
         /** Constructor
@@ -133,7 +140,7 @@ namespace Legacy
 
         /** GetTxn
          *
-         *  Retrieves the most recently started database transaction.
+         *  Retrieves the most recently started database transaction on the calling thread.
          *
          *  This method does not lock the cs_db mutex and should be called within lock scope.
          *
@@ -143,6 +150,19 @@ namespace Legacy
         DbTxn* GetTxn();
 
 
+        /** WaitTxn
+         *
+         *  Waits until no other thread has a transaction open. The environment runs without locking,
+         *  so a write outside of a transaction must not touch pages that another thread may still abort.
+         *
+         *  This method must be called with cs_db held by the given lock, which is released while waiting.
+         *
+         *  @param[in] lock The lock holding cs_db
+         *
+         **/
+        void WaitTxn(std::unique_lock<std::mutex>& lock);
+
+
     public:
         
 
@@ -256,6 +276,8 @@ namespace Legacy
          *  If it does exist, the corresponding value will be overwritten if fOverwrite is set.
          *  Otherwise, this method will return false (write not successful)
          *
+         *  Waits for any transaction open on another thread to end first.
+         *
          *  @param[in] key The key entry to write
          *
          *  @param[in] value The value to write for the provided key value.
@@ -269,7 +291,8 @@ namespace Legacy
         template<typename K, typename T>
         bool Write(const K& key, const T& value, bool fOverwrite=true)
         {
-            LOCK(cs_db);
+            std::unique_lock<std::mutex> lock(cs_db);
+            WaitTxn(lock);
 
             if(pdb == nullptr)
                 OpenHandle();
@@ -302,6 +325,7 @@ namespace Legacy
          *  Remove a key-value pair from the database
          *
          *  Cannot erase from a database opened as read-only.
+         *  Waits for any transaction open on another thread to end first.
          *
          *  @param[in] key The key value of the database entry to erase
          *
@@ -311,7 +335,8 @@ namespace Legacy
         template<typename K>
         inline bool Erase(const K& key)
         {
-            LOCK(cs_db);
+            std::unique_lock<std::mutex> lock(cs_db);
+            WaitTxn(lock);
 
             if(pdb == nullptr)
                 OpenHandle();
@@ -420,7 +445,8 @@ namespace Legacy
 
         /** TxnBegin
          *
-         *  Start a new database transaction and add it to vTxn
+         *  Start a new database transaction on the calling thread, nested in any it already has open.
+         *  Waits for any transaction open on another thread to end first.
          *
          *  @return true if transaction successfully started
          *
@@ -430,7 +456,7 @@ namespace Legacy
 
         /** TxnCommit
          *
-         *  Commit the transaction most recently added to vTxn
+         *  Commit the transaction most recently started on the calling thread
          *
          *  @return true if transaction successfully committed
          *
@@ -440,7 +466,7 @@ namespace Legacy
 
         /** TxnAbort
          *
-         *  Abort the transaction most recently added to vTxn,
+         *  Abort the transaction most recently started on the calling thread,
          *  reversing any updates performed.
          *
          *  @return true if transaction was successfully aborted
@@ -241,6 +241,16 @@ namespace Legacy
         uint64_t nWalletUnlockTime;
 
 
+        /** Wallet transactions that may still have unspent outputs belonging to this wallet.
+         *  Balance and coin selection only visit these, dropping any they find fully spent.
+         **/
+        std::set<uint512_t> setUnspent;
+
+
+        /** Flag to rebuild setUnspent from all of mapWallet, set when keys may have changed which outputs are ours. **/
+        bool fUnspentStale;
+
+
 
     public:
         /** Mutex for thread concurrency across wallet operations **/
@@ -785,7 +795,8 @@ namespace Legacy
          *  @param[in] fUpdate If true, any transaction found by scan that is already in the
          *                     wallet will be updated
          *
-         *  @return The number of transactions added/updated by the scan
+         *  @return The number of transactions added/updated by the scan, or 0 if the wallet file
+         *          could not be updated and the scan must be run again
          *
          **/
         uint32_t ScanForWalletTransactions(const TAO::Ledger::BlockState& stateBegin, const bool fUpdate = false);
@@ -1076,6 +1087,17 @@ namespace Legacy
 
 
     private:
+        /** GetUnspent
+         *
+         *  Gets the wallet transactions that still have unspent outputs belonging to this wallet,
+         *  dropping any from setUnspent that have none left. cs_wallet must be locked by the caller.
+         *
+         *  @return Iterators to the transactions, in mapWallet order
+         *
+         **/
+        std::vector<TransactionMap::const_iterator> GetUnspent();
+
+
     /*----------------------------------------------------------------------------------------*/
     /*  Load Wallet operations - require WalletDB declared friend                            */
     /*----------------------------------------------------------------------------------------*/
@@ -18,6 +18,7 @@ ________________________________________________________________________________
 #include <atomic>
 #include <list>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <thread>
 #include <vector>
@@ -544,6 +545,46 @@ namespace Legacy
         bool EncryptDatabase(const uint32_t nNewMasterKeyId, const MasterKey& kMasterKey, const CryptedKeyMap& mapNewEncryptedKeys);
 
 
+        /** TxnBegin
+         *
+         *  Starts a batch of database updates. Everything this thread writes until the matching TxnCommit or
+         *  TxnAbort is applied as a single database transaction, and the flush thread waits until the batch ends.
+         *  Writes from other threads are not part of the batch, and wait until it ends.
+         *
+         *  A batch begun while this thread already has one open joins the open batch. Only one thread
+         *  may have a batch open, so this returns false without waiting if another thread holds one.
+         *  Callers should then carry on writing without a batch, and only end batches they began.
+         *  Prefer WalletBatch, which ends the batch if an exception is thrown.
+         *
+         *  Lock the wallet before starting a batch, as threads holding it may be waiting to write.
+         *
+         *  @return true if the batch was started, false otherwise
+         *
+         **/
+        bool TxnBegin();
+
+
+        /** TxnCommit
+         *
+         *  Ends a batch started by TxnBegin. The outermost batch commits all of its updates, unless
+         *  any batch within it was aborted, in which case they are all discarded.
+         *
+         *  @return true on success, false if the updates were discarded or the commit failed
+         *
+         **/
+        bool TxnCommit();
+
+
+        /** TxnAbort
+         *
+         *  Ends a batch started by TxnBegin, discarding all updates made within the outermost batch.
+         *
+         *  @return true on success, false otherwise
+         *
+         **/
+        bool TxnAbort();
+
+
         /** DBRewrite
          *
          *  Rewrites the backing database by copying all contents.
@@ -629,6 +670,95 @@ namespace Legacy
          **/
         static std::atomic<bool> fDbInProgress;
 
+
+        /** Mutex held by the thread with a batch of updates open, from TxnBegin until the outermost batch ends. **/
+        static std::recursive_mutex csBatch;
+
+
+        /** The number of batches open on the thread holding csBatch. **/
+        static uint32_t nBatchDepth;
+
+
+        /** Flag set when a batch is aborted, so the outermost batch discards its updates. **/
+        static bool fBatchAborted;
+
+
+        /** end_batch
+         *
+         *  Ends the innermost open batch, committing or aborting the database transaction if it is the outermost.
+         *
+         *  @param[in] fAbort true to discard the batch updates.
+         *
+         *  @return true on success, false otherwise
+         *
+         **/
+        bool end_batch(const bool fAbort);
+
+    };
+
+
+    /** @class WalletBatch
+     *
+     *  Holds a batch of wallet database updates open for its lifetime, see WalletDB::TxnBegin.
+     *  The batch is aborted when this goes out of scope without being committed, so an exception
+     *  can't leave it open.
+     *
+     **/
+    class WalletBatch
+    {
+        /** The wallet database the batch is open on. **/
+        WalletDB& walletdb;
+
+
+        /** Flag indicating the batch is open. **/
+        bool fActive;
+
+    public:
+
+        /** Constructor
+         *
+         *  Begins a batch on the wallet database.
+         *
+         *  @param[in] walletdbIn The wallet database to batch updates for.
+         *  @param[in] fBegin false to not batch at all, such as for a wallet that isn't file backed.
+         *
+         **/
+        explicit WalletBatch(WalletDB& walletdbIn, const bool fBegin = true);
+
+
+        /** Copy Constructor. **/
+        WalletBatch(const WalletBatch&) = delete;
+
+
+        /** Copy Assignment. **/
+        WalletBatch& operator=(const WalletBatch&) = delete;
+
+
+        /** Destructor
+         *
+         *  Aborts the batch if it was not committed.
+         *
+         **/
+        ~WalletBatch();
+
+
+        /** Active
+         *
+         *  Checks if the batch is open. When it isn't, updates were written directly.
+         *
+         **/
+        bool Active() const;
+
+
+        /** Commit
+         *
+         *  Ends the batch, committing its updates.
+         *
+         *  @return true on success, false if there was no batch open or the commit failed
+         *
+         **/
+        bool Commit();
+
     };
 
 }
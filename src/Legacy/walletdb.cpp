@@ -68,6 +68,18 @@ namespace Legacy
     std::atomic<bool> WalletDB::fDbInProgress(false);
 
 
+    /* Mutex for the open batch of updates. */
+    std::recursive_mutex WalletDB::csBatch;
+
+
+    /* Number of batches open on the thread holding csBatch. */
+    uint32_t WalletDB::nBatchDepth = 0;
+
+
+    /* Flag if an open batch was aborted. */
+    bool WalletDB::fBatchAborted = false;
+
+
     /* Constructor */
     WalletDB::WalletDB()
     : strWalletFile(WalletDB::DEFAULT_WALLET_DB)
@@ -791,6 +803,131 @@ namespace Legacy
     }
 
 
+    /* Starts a batch of database updates. */
+    bool WalletDB::TxnBegin()
+    {
+        /* Only one thread can batch at a time, as the database runs without the locking that would isolate
+         * concurrent transactions. Don't wait for another thread's batch, as it may need locks held by our caller.
+         */
+        if(!csBatch.try_lock())
+            return false;
+
+        /* Nested batches join the open one. */
+        if(nBatchDepth++ > 0)
+            return true;
+
+        /* Don't flush during the batch. See LoadWallet() for discussion of this code. */
+        bool fExpectedValue = false;
+        bool fDesiredValue = true;
+        while (!WalletDB::fDbInProgress.compare_exchange_weak(fExpectedValue, fDesiredValue))
+        {
+            runtime::sleep(100);
+            fExpectedValue = false;
+        }
+
+        fBatchAborted = false;
+        if(!BerkeleyDB::GetInstance().TxnBegin())
+        {
+            WalletDB::fDbInProgress.store(false);
+
+            nBatchDepth = 0;
+            csBatch.unlock();
+
+            return debug::error(FUNCTION, "Unable to begin database transaction for ", strWalletFile);
+        }
+
+        return true;
+    }
+
+
+    /* Ends a batch of database updates, committing them. */
+    bool WalletDB::TxnCommit()
+    {
+        return end_batch(false);
+    }
+
+
+    /* Ends a batch of database updates, discarding them. */
+    bool WalletDB::TxnAbort()
+    {
+        return end_batch(true);
+    }
+
+
+    /* Ends the innermost open batch. */
+    bool WalletDB::end_batch(const bool fAbort)
+    {
+        RLOCK(csBatch);
+
+        /* Check that this thread has a batch open. */
+        if(nBatchDepth == 0)
+            return debug::error(FUNCTION, "No batch open on ", strWalletFile);
+
+        if(fAbort)
+            fBatchAborted = true;
+
+        /* Inner batches are settled by the outermost one. */
+        bool fSuccessful = true;
+        if(--nBatchDepth == 0)
+        {
+            BerkeleyDB& db = BerkeleyDB::GetInstance();
+            if(fBatchAborted)
+            {
+                if(!db.TxnAbort())
+                    fSuccessful = debug::error(FUNCTION, "Error aborting batch updates to ", strWalletFile);
+            }
+            else if(!db.TxnCommit())
+                fSuccessful = debug::error(FUNCTION, "Error committing batch updates to ", strWalletFile);
+
+            /* Ok to flush again. */
+            WalletDB::fDbInProgress.store(false);
+        }
+
+        /* A commit fails if any part of its batch was aborted. */
+        if(!fAbort && fBatchAborted)
+            fSuccessful = false;
+
+        /* Release the hold taken by the matching TxnBegin. */
+        csBatch.unlock();
+
+        return fSuccessful;
+    }
+
+
+    /* Begins a batch on the wallet database. */
+    WalletBatch::WalletBatch(WalletDB& walletdbIn, const bool fBegin)
+    : walletdb (walletdbIn)
+    , fActive  (fBegin && walletdb.TxnBegin())
+    {
+    }
+
+
+    /* Aborts the batch if it was not committed. */
+    WalletBatch::~WalletBatch()
+    {
+        if(fActive)
+            walletdb.TxnAbort();
+    }
+
+
+    /* Checks if the batch is open. */
+    bool WalletBatch::Active() const
+    {
+        return fActive;
+    }
+
+
+    /* Ends the batch, committing its updates. */
+    bool WalletBatch::Commit()
+    {
+        if(!fActive)
+            return false;
+
+        fActive = false;
+        return walletdb.TxnCommit();
+    }
+
+
     /* Rewrites the backing database by copying all contents. */
     bool WalletDB::DBRewrite()
     {
@@ -222,10 +222,11 @@ namespace TAO
                 }
 
                 /* Add mutable flag */
-                field["mutable"] = object.mapData[strName].second;
+                const bool fMutable = object.pLayout->Find(strName)->fMutable;
+                field["mutable"] = fMutable;
 
                 /* If mutable, add the max size */
-                if(object.mapData[strName].second && nMaxSize > 0)
+                if(fMutable && nMaxSize > 0)
                     field["maxlength"] = nMaxSize;
 
                 /* Add the field to the response array */
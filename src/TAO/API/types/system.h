@@ -139,19 +139,17 @@ namespace TAO
             json::json Metrics(const json::json& params, bool fHelp);
 
 
-
-        private:
-
-            /** count_registers
-            *
-            *  Returns the count of registers of the given type in the register DB
-            *
-            *  @param[in] strType the register type to count
-            *
-            *  @return number of unique registers in the register DB of the specified type.
-            *
-            **/
-            uint64_t count_registers(const std::string& strType);
+            /** ListRequests
+             *
+             *  Returns the queue wait and execution latency for each API and RPC method.
+             *
+             *  @param[in] params The parameters from the API call.
+             *  @param[in] fHelp Trigger for help data.
+             *
+             *  @return The return object in JSON.
+             *
+             **/
+            json::json ListRequests(const json::json& params, bool fHelp);
 
         };
     }
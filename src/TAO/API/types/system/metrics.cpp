@@ -11,6 +11,8 @@
 
 ____________________________________________________________________________________________*/
 
+#include <LLC/include/argon2_pool.h>
+
 #include <LLD/include/global.h>
 
 #include <TAO/Ledger/include/constants.h>
@@ -19,7 +21,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/retarget.h>
 #include <TAO/Ledger/include/supply.h>
 
-#include <TAO/Register/types/object.h>
+#include <TAO/Register/types/metrics.h>
 
 #include <TAO/API/types/system.h>
 
@@ -39,130 +41,39 @@ namespace TAO
             /* Build json response. */
             json::json jsonRet;
 
-            /* Keep track of global stats. */
-            uint64_t nTotalStake = 0;
-            uint64_t nTotalTrust = 0;
-            uint64_t nTotalTrustKeys  = 0;
-            
-            uint64_t nTotalNames = 0;
-            uint64_t nTotalGlobalNames = 0;
-            uint64_t nTotalNamespacedNames = 0;
-            uint64_t nTotalNamespaces = count_registers("namespace");
-            uint64_t nTotalAccounts = count_registers("account");
-            uint64_t nTotalCrypto = count_registers("crypto");
-            uint64_t nTotalTokens = count_registers("token");
-
-            uint64_t nTotalAppend = count_registers("append");
-            uint64_t nTotalRaw = count_registers("raw");
-            uint64_t nTotalReadOnly = count_registers("readonly");
-            
-            uint64_t nTotalObjects = 0;
-            uint64_t nTotalTokenized = 0;
-
-            /* There is one crypto register per sig chain so just counting these is a reliable count of the sig chains */
-            uint64_t nTotalSigChains = nTotalCrypto;
-
-
-            /* Batch read all trust keys. */
-            std::vector<TAO::Register::Object> vTrust;
-            if(LLD::Register->BatchRead("trust", vTrust, -1))
-            {
-                /* Check through all trust accounts. */
-                for(auto& object : vTrust)
-                {
-                    /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                    if(!object.Parse())
-                        continue;
-
-                    /* Check stake value over 0. */
-                    if(object.get<uint64_t>("stake") == 0)
-                        continue;
-
-                    /* Update stake amount. */
-                    nTotalStake += object.get<uint64_t>("stake");
-                    nTotalTrust += object.get<uint64_t>("trust");
-                    nTotalTrustKeys  ++;
-
-                }
-            }
-
-            /* Batch read all names. */
-            std::vector<TAO::Register::Object> vNames;
-            if(LLD::Register->BatchRead("name", vNames, -1))
-            {
-                /* Check through all names. */
-                for(auto& object : vNames)
-                {
-                    /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                    if(!object.Parse())
-                        continue;
-
-                    /* global */
-                    if(object.get<std::string>("namespace") == TAO::Register::NAMESPACE::GLOBAL)
-                        nTotalGlobalNames ++;
-                    /* namespaced */
-                    else if(object.get<std::string>("namespace") != "" )
-                        nTotalNamespacedNames ++;
-
-                    /* Update count*/
-                    nTotalNames  ++;
-
-                }
-            }
-
-            /* Batch read all object registers. */
-            std::vector<TAO::Register::Object> vObjects;
-            if(LLD::Register->BatchRead("object", vObjects, -1))
-            {
-                /* Check through all names. */
-                for(auto& object : vObjects)
-                {
-                    /* Skip over invalid objects (THIS SHOULD NEVER HAPPEN). */
-                    if(!object.Parse())
-                        continue;
-
-                    /* Check if tokenized*/
-                    if(TAO::Register::Address(object.hashOwner).IsToken() )
-                        nTotalTokenized ++;
-
-                    /* Update count*/
-                    nTotalObjects  ++;
-                }
-            }
-
-            /* Calculate count of all registers */
-            uint64_t nTotalRegisters = nTotalTrustKeys + nTotalNames +nTotalNamespaces + nTotalAccounts + nTotalCrypto
-                    + nTotalTokens + nTotalAppend + nTotalRaw + nTotalReadOnly + nTotalObjects;
-
+            /* Read the register aggregates. */
+            TAO::Register::Metrics metrics;
+            if(!LLD::Register->ReadMetrics(metrics))
+                throw APIException(-255, "Register metrics not indexed");
 
             /* Add register metrics */
             json::json jsonRegisters;
-            jsonRegisters["total"] = nTotalRegisters;
-            jsonRegisters["account"] = nTotalAccounts;
-            jsonRegisters["append"] = nTotalAppend;
-            jsonRegisters["crypto"] = nTotalCrypto;
-            jsonRegisters["name"]  = nTotalNames;
-            jsonRegisters["name_global"]  = nTotalGlobalNames;
-            jsonRegisters["name_namespaced"]  = nTotalNamespacedNames;
-            jsonRegisters["namespace"] = nTotalNamespaces;
-            jsonRegisters["object"] = nTotalObjects;
-            jsonRegisters["object_tokenized"] = nTotalTokenized;
-            jsonRegisters["raw"] = nTotalRaw;
-            jsonRegisters["readonly"] = nTotalReadOnly;
-            jsonRegisters["token"] = nTotalTokens;
+            jsonRegisters["total"] = metrics.Registers();
+            jsonRegisters["account"] = metrics.nAccounts;
+            jsonRegisters["append"] = metrics.nAppend;
+            jsonRegisters["crypto"] = metrics.nCrypto;
+            jsonRegisters["name"]  = metrics.nNames;
+            jsonRegisters["name_global"]  = metrics.nGlobalNames;
+            jsonRegisters["name_namespaced"]  = metrics.nNamespacedNames;
+            jsonRegisters["namespace"] = metrics.nNamespaces;
+            jsonRegisters["object"] = metrics.nObjects;
+            jsonRegisters["object_tokenized"] = metrics.nTokenized;
+            jsonRegisters["raw"] = metrics.nRaw;
+            jsonRegisters["readonly"] = metrics.nReadOnly;
+            jsonRegisters["token"] = metrics.nTokens;
             jsonRet["registers"] = jsonRegisters;
 
-            /* Add sig chain metrics */
-            jsonRet["sig_chains"] = nTotalSigChains;
-            
+            /* There is one crypto register per sig chain so just counting these is a reliable count of the sig chains */
+            jsonRet["sig_chains"] = metrics.nCrypto;
+
             /* Add trust metrics */
             json::json jsonTrust;
-            jsonTrust["total"]  = nTotalTrustKeys;
-            jsonTrust["stake"] = double(nTotalStake / TAO::Ledger::NXS_COIN);
-            jsonTrust["trust"] = nTotalTrust;
+            jsonTrust["total"]  = metrics.nTrustKeys;
+            jsonTrust["stake"] = double(metrics.nStake / TAO::Ledger::NXS_COIN);
+            jsonTrust["trust"] = metrics.nTrust;
             jsonRet["trust"] = jsonTrust;
 
-            
+
             /* Add supply metrics */
             json::json jsonSupply;
 
@@ -211,20 +122,23 @@ namespace TAO
             jsonReserves["hash"] = fHasHash ? double(lastHashBlockState.nReleasedReserve[0]) / TAO::Ledger::NXS_COIN : 0;
             jsonReserves["prime"] = fHasPrime ? double(lastPrimeBlockState.nReleasedReserve[0]) / TAO::Ledger::NXS_COIN : 0;
             jsonRet["reserves"] = jsonReserves;
-            
 
-            return jsonRet;
-        }
+            /* Add key derivation metrics, times in milliseconds. */
+            const LLC::Argon2Pool::Stats stats = LLC::Argon2Pool::GetInstance().GetStats();
 
+            json::json jsonArgon2;
+            jsonArgon2["derived"]   = stats.nDerived;
+            jsonArgon2["oversized"] = stats.nOversized;
+            jsonArgon2["arenas"]    = stats.nArenas;
+            jsonArgon2["locked"]    = stats.nLocked;
+            jsonArgon2["waiting"]   = stats.nWaiting;
+            jsonArgon2["peakwaiting"] = stats.nPeakWaiting;
+            jsonArgon2["wait"]      = stats.nDerived ? (stats.nWaitTime / stats.nDerived) / 1000.0 : 0.0;
+            jsonArgon2["hash"]      = stats.nDerived ? (stats.nHashTime / stats.nDerived) / 1000.0 : 0.0;
+            jsonRet["argon2"] = jsonArgon2;
 
-        /* Returns the count of registers of the given type in the register DB */
-        uint64_t System::count_registers(const std::string& strType)
-        {
-            /* Batch read all registers . */
-            std::vector<TAO::Register::Object> vRegisters;
-            LLD::Register->BatchRead(strType, vRegisters, -1);
-            
-            return vRegisters.size();
+
+            return jsonRet;
         }
     }
 }
@@ -0,0 +1,66 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/API/types/system.h>
+
+#include <LLP/include/request_pool.h>
+
+#include <Util/include/json.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* API Layer namespace. */
+    namespace API
+    {
+
+        /* Returns the queue wait and execution latency for each API and RPC method. */
+        json::json System::ListRequests(const json::json& params, bool fHelp)
+        {
+            /* Check that we have request workers. */
+            LLP::RequestPool* pPool = LLP::REQUEST_POOL.load();
+            if(!pPool)
+                throw APIException(-256, "Request workers not running");
+
+            json::json jsonRet;
+            jsonRet["pending"] = pPool->Pending();
+
+            /* Add the latencies for each method, in milliseconds. */
+            json::json jsonMethods = json::json::array();
+            for(const auto& stat : pPool->GetStats())
+            {
+                const LLP::RequestPool::Stats& stats = stat.second;
+
+                json::json jsonMethod;
+                jsonMethod["method"]    = stat.first;
+                jsonMethod["completed"] = stats.nCompleted;
+                jsonMethod["rejected"]  = stats.nRejected;
+                jsonMethod["active"]    = stats.nActive;
+
+                /* Queue wait time. */
+                jsonMethod["queue"]["average"] = stats.nCompleted ? (stats.nQueueTime / stats.nCompleted) / 1000.0 : 0.0;
+                jsonMethod["queue"]["max"]     = stats.nQueueMax / 1000.0;
+
+                /* Execution time. */
+                jsonMethod["execute"]["average"] = stats.nCompleted ? (stats.nExecuteTime / stats.nCompleted) / 1000.0 : 0.0;
+                jsonMethod["execute"]["max"]     = stats.nExecuteMax / 1000.0;
+
+                jsonMethods.push_back(jsonMethod);
+            }
+            jsonRet["methods"] = jsonMethods;
+
+            return jsonRet;
+        }
+    }
+}
@@ -27,6 +27,7 @@ ________________________________________________________________________________
 #include <Util/include/mutex.h>
 #include <Util/include/memory.h>
 #include <condition_variable>
+#include <map>
 #include <thread>
 #include <atomic>
 #include <vector>
@@ -84,6 +85,64 @@ namespace TAO
             std::atomic<bool> fShutdown;
 
 
+            /** EventCursor
+             *
+             *  Tracks how far back the events of a genesis are settled, so the events processor only checks newer ones.
+             *  A point the walk finds settled is held as pending, and only becomes the cursor once it has stayed settled
+             *  for coinbase maturity, so a rollback can't reopen events behind the cursor.
+             *
+             **/
+            template<typename TypeSequence>
+            struct EventCursor
+            {
+                /** Events from here back are settled and are not checked again. **/
+                TypeSequence nSettled;
+
+
+                /** Events from here back were settled at nHeight. **/
+                TypeSequence nPending;
+
+
+                /** The best height when nPending was found settled. **/
+                uint32_t nHeight;
+
+
+                /** The number of events at the last walk, to catch events erased by a rollback. **/
+                uint32_t nEvents;
+
+
+                /** Flag indicating nPending is set. **/
+                bool fPending;
+
+
+                /** Default Constructor. **/
+                EventCursor()
+                : nSettled (0)
+                , nPending (0)
+                , nHeight  (0)
+                , nEvents  (0)
+                , fPending (false)
+                {
+                }
+            };
+
+
+            /** The mutex for the event cursors. **/
+            static std::mutex CURSOR_MUTEX;
+
+
+            /** The event sequence cursors per genesis. **/
+            static std::map<uint256_t, EventCursor<uint32_t> > mapEventCursor;
+
+
+            /** The legacy event sequence cursors per genesis. **/
+            static std::map<uint256_t, EventCursor<uint32_t> > mapLegacyCursor;
+
+
+            /** The sigchain transaction cursors per genesis, for coinbases. **/
+            static std::map<uint256_t, EventCursor<uint512_t> > mapCoinbaseCursor;
+
+
         public:
 
 
@@ -673,6 +732,20 @@ namespace TAO
                 std::vector<std::pair<std::shared_ptr<Legacy::Transaction>, uint32_t>> &vContracts);
 
 
+            /** settle_cursor
+             *
+             *  Updates an event cursor after a walk. The pending point becomes the cursor once it has stayed settled
+             *  for coinbase maturity, and the point this walk found settled becomes pending if there is none.
+             *
+             *  @param[in,out] cursor The cursor to update.
+             *  @param[in] nSettled The point this walk found settled, with everything before it.
+             *  @param[in] fPendingOpen True if this walk found an open event at or before the pending point.
+             *
+             **/
+            template<typename TypeSequence>
+            static void settle_cursor(EventCursor<TypeSequence>& cursor, const TypeSequence& nSettled, const bool fPendingOpen);
+
+
             /** create_sig_chain
              *
              *  Creates a signature chain for the given credentials and returns the transaction object if successful
@@ -113,6 +113,32 @@ namespace TAO
         }
 
 
+        /* Updates an event cursor after a walk. */
+        template<typename TypeSequence>
+        void Users::settle_cursor(EventCursor<TypeSequence>& cursor, const TypeSequence& nSettled, const bool fPendingOpen)
+        {
+            /* Get the current best height. */
+            const uint32_t nHeight = TAO::Ledger::ChainState::nBestHeight.load();
+
+            /* Move the cursor to the pending point once it has stayed settled for coinbase maturity. Anything a rollback
+             * could still undo is then in front of the cursor and gets checked again. */
+            if(cursor.fPending && !fPendingOpen
+            && nHeight >= cursor.nHeight + TAO::Ledger::MaturityCoinBase(TAO::Ledger::ChainState::stateBest.load()))
+            {
+                cursor.nSettled = cursor.nPending;
+                cursor.fPending = false;
+            }
+
+            /* Start a new pending point if there is none, or the last one was found open again. */
+            if(!cursor.fPending || fPendingOpen)
+            {
+                cursor.nPending = nSettled;
+                cursor.nHeight  = nHeight;
+                cursor.fPending = true;
+            }
+        }
+
+
         /* Get the outstanding debits and transfer transactions. */
         bool Users::get_events(const uint256_t& hashGenesis,
                 std::vector<std::tuple<TAO::Operation::Contract, uint32_t, uint256_t>> &vContracts)
@@ -132,11 +158,29 @@ namespace TAO
             /* Get the last event */
             LLD::Ledger->ReadSequence(hashGenesis, nSequence);
 
+            /* Events before the cursor are settled, so only newer events need checking. */
+            EventCursor<uint32_t> cursor;
+            {
+                LOCK(CURSOR_MUTEX);
+                if(mapEventCursor.count(hashGenesis))
+                    cursor = mapEventCursor[hashGenesis];
+            }
+
+            /* A rollback erases events and new events reuse their sequences, so start over if there are fewer. */
+            if(nSequence < cursor.nEvents)
+                cursor = EventCursor<uint32_t>();
+
+            cursor.nEvents = nSequence;
+            const uint32_t nCursor = std::min(cursor.nSettled, nSequence);
+
+            /* The new cursor is the oldest event we find still open. */
+            uint32_t nSettled = nSequence;
+
             /* Decrement the current sequence number to get the last event sequence number */
             --nSequence;
 
             /* Look back through all events to find those that are not yet processed. */
-            while(LLD::Ledger->ReadEvent(hashGenesis, nSequence, tx))
+            while(nSequence >= nCursor && LLD::Ledger->ReadEvent(hashGenesis, nSequence, tx))
             {
                 /* Check to see if we have 100 (or the user configured amount) consecutive processed events.  If we do then we
                    assume all prior events are also processed.  This saves us having to scan the entire chain of events */
@@ -147,6 +191,7 @@ namespace TAO
                 if(!LLD::Ledger->ReadMature(tx.GetHash()))
                 {
                     /* If not, decrement the sequence id and continue to the next event. */
+                    nSettled = nSequence;
                     --nSequence;
                     continue;
                 }
@@ -246,6 +291,10 @@ namespace TAO
                             /* Make sure we haven't already claimed it */
                             if(LLD::Ledger->HasProof(hashRegister, tx.GetHash(), nContract, TAO::Ledger::FLAGS::MEMPOOL))
                             {
+                                /* A claim still in the mempool leaves the event open. */
+                                if(!LLD::Ledger->HasProof(hashRegister, tx.GetHash(), nContract))
+                                    nSettled = nSequence;
+
                                 nConsecutive++;
                                 continue;
                             }
@@ -275,6 +324,10 @@ namespace TAO
                     uint512_t hashTx = tx.GetHash();
                     if(LLD::Ledger->HasProof(hashProof, hashTx, nContract, TAO::Ledger::FLAGS::MEMPOOL))
                     {
+                        /* A credit still in the mempool leaves the event open. */
+                        if(!LLD::Ledger->HasProof(hashProof, hashTx, nContract))
+                            nSettled = nSequence;
+
                         nConsecutive++;
                         continue;
                     }
@@ -293,12 +346,20 @@ namespace TAO
 
                     /* Reset the consecutive counter since this has not been processed */
                     nConsecutive = 0;
+                    nSettled = nSequence;
                 }
 
                 /* Iterate the sequence id backwards. */
                 --nSequence;
             }
 
+            /* Move the cursor up towards the oldest open event. */
+            settle_cursor(cursor, nSettled, nSettled < cursor.nPending);
+            {
+                LOCK(CURSOR_MUTEX);
+                mapEventCursor[hashGenesis] = cursor;
+            }
+
             return true;
         }
 
@@ -318,11 +379,29 @@ namespace TAO
             /* Get the last event */
             LLD::Legacy->ReadSequence(hashGenesis, nSequence);
 
+            /* Events before the cursor are settled, so only newer events need checking. */
+            EventCursor<uint32_t> cursor;
+            {
+                LOCK(CURSOR_MUTEX);
+                if(mapLegacyCursor.count(hashGenesis))
+                    cursor = mapLegacyCursor[hashGenesis];
+            }
+
+            /* A rollback erases events and new events reuse their sequences, so start over if there are fewer. */
+            if(nSequence < cursor.nEvents)
+                cursor = EventCursor<uint32_t>();
+
+            cursor.nEvents = nSequence;
+            const uint32_t nCursor = std::min(cursor.nSettled, nSequence);
+
+            /* The new cursor is the oldest event we find still open. */
+            uint32_t nSettled = nSequence;
+
             /* Decrement the current sequence number to get the last event sequence number */
             --nSequence;
 
             /* Look back through all events to find those that are not yet processed. */
-            while(LLD::Legacy->ReadEvent(hashGenesis, nSequence, tx))
+            while(nSequence >= nCursor && LLD::Legacy->ReadEvent(hashGenesis, nSequence, tx))
             {
                 /* Check to see if we have 100 (or the user configured amount) consecutive processed events.  If we do then we
                    assume all prior events are also processed.  This saves us having to scan the entire chain of events */
@@ -354,6 +433,10 @@ namespace TAO
                     /* Check if proofs are spent. NOTE the proof is the wildcard address since this is a legacy transaction*/
                     if(LLD::Ledger->HasProof(TAO::Register::WILDCARD_ADDRESS, ptx->GetHash(), nContract, TAO::Ledger::FLAGS::MEMPOOL))
                     {
+                        /* A credit still in the mempool leaves the event open. */
+                        if(!LLD::Ledger->HasProof(TAO::Register::WILDCARD_ADDRESS, ptx->GetHash(), nContract))
+                            nSettled = nSequence;
+
                         nConsecutive++;
                         continue;
                     }
@@ -363,12 +446,20 @@ namespace TAO
 
                     /* Reset the consecutive counter since this has not been processed */
                     nConsecutive = 0;
+                    nSettled = nSequence;
                 }
 
                 /* Iterate the sequence id backwards. */
                 --nSequence;
             }
 
+            /* Move the cursor up towards the oldest open event. */
+            settle_cursor(cursor, nSettled, nSettled < cursor.nPending);
+            {
+                LOCK(CURSOR_MUTEX);
+                mapLegacyCursor[hashGenesis] = cursor;
+            }
+
             return true;
         }
 
@@ -488,9 +579,28 @@ namespace TAO
             /* Counter of consecutive claimed coinbases.  If this reaches 10 then assume there are none older to process */
             uint32_t nConsecutive = 0;
 
+            /* Coinbases from the cursor back are settled, so only newer transactions need checking. */
+            EventCursor<uint512_t> cursor;
+            {
+                LOCK(CURSOR_MUTEX);
+                if(mapCoinbaseCursor.count(hashGenesis))
+                    cursor = mapCoinbaseCursor[hashGenesis];
+            }
+
+            /* The new cursor is the transaction before the oldest one we find with an open coinbase. */
+            uint512_t hashSettled = hashLast;
+
+            /* Track whether we found an open coinbase at or before the pending point. */
+            bool fPassed = false;
+            bool fPendingOpen = false;
+
             /* Reverse iterate until genesis (newest to oldest). */
-            while(hashLast != 0)
+            while(hashLast != 0 && hashLast != cursor.nSettled)
             {
+                /* Check for the pending point. */
+                if(cursor.fPending && hashLast == cursor.nPending)
+                    fPassed = true;
+
                 /* Get the transaction from disk. */
                 TAO::Ledger::Transaction tx;
                 if(!LLD::Ledger->ReadTx(hashLast, tx, TAO::Ledger::FLAGS::MEMPOOL))
@@ -501,6 +611,9 @@ namespace TAO
                 {
                     /* Set the next last. */
                     hashLast = !tx.IsFirst() ? tx.hashPrevTx : 0;
+                    hashSettled = hashLast;
+                    fPendingOpen = fPendingOpen || fPassed;
+
                     continue;
                 }
 
@@ -528,6 +641,13 @@ namespace TAO
                         /* Check if proofs are spent. */
                         if(LLD::Ledger->HasProof(hashGenesis, hashLast, nContract, TAO::Ledger::FLAGS::MEMPOOL))
                         {
+                            /* A credit still in the mempool leaves the coinbase open. */
+                            if(!LLD::Ledger->HasProof(hashGenesis, hashLast, nContract))
+                            {
+                                hashSettled = !tx.IsFirst() ? tx.hashPrevTx : 0;
+                                fPendingOpen = fPendingOpen || fPassed;
+                            }
+
                             /* Increment the counter of consecutive claims */
                             ++nConsecutive;
                             continue;
@@ -535,6 +655,8 @@ namespace TAO
 
                         /* Reset the counter since this one has not been claimed */
                         nConsecutive = 0;
+                        hashSettled = !tx.IsFirst() ? tx.hashPrevTx : 0;
+                        fPendingOpen = fPendingOpen || fPassed;
 
                         /* Add the coinbase transaction and skip rest of contracts. */
                         vContracts.push_back(std::make_tuple(contract, nContract, 0));
@@ -551,6 +673,13 @@ namespace TAO
                 hashLast = !tx.IsFirst() ? tx.hashPrevTx : 0;
             }
 
+            /* Move the cursor up towards the oldest open coinbase. */
+            settle_cursor(cursor, hashSettled, fPendingOpen);
+            {
+                LOCK(CURSOR_MUTEX);
+                mapCoinbaseCursor[hashGenesis] = cursor;
+            }
+
             return true;
         }
 
@@ -41,6 +41,22 @@ namespace TAO
         static memory::encrypted_ptr<TAO::Ledger::SignatureChain> null_ptr;
 
 
+        /* The mutex for the event cursors. */
+        std::mutex Users::CURSOR_MUTEX;
+
+
+        /* The event sequence cursors per genesis. */
+        std::map<uint256_t, Users::EventCursor<uint32_t> > Users::mapEventCursor;
+
+
+        /* The legacy event sequence cursors per genesis. */
+        std::map<uint256_t, Users::EventCursor<uint32_t> > Users::mapLegacyCursor;
+
+
+        /* The sigchain transaction cursors per genesis, for coinbases. */
+        std::map<uint256_t, Users::EventCursor<uint512_t> > Users::mapCoinbaseCursor;
+
+
         /* Default Constructor. */
         Users::Users()
         : Base()
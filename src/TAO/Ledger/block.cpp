@@ -12,6 +12,8 @@
 ____________________________________________________________________________________________*/
 
 #include <LLC/hash/SK.h>
+#include <LLC/hash/batch.h>
+#include <LLC/hash/writer.h>
 #include <LLC/hash/macro.h>
 #include <LLC/include/eckey.h>
 #include <LLC/types/bignum.h>
@@ -288,17 +290,27 @@ namespace TAO
             uint32_t j = 0;
             uint32_t nSize = static_cast<uint32_t>(vMerkleTree.size());
 
+            /* Buffer to lay out each level's pairs back to back, so the whole level is hashed as one batch. */
+            std::vector<uint8_t> vPairs;
             for(; nSize > 1; nSize = (nSize + 1) >> 1)
             {
+                const uint32_t nPairs = (nSize + 1) >> 1;
+                vPairs.resize(nPairs * 128);
+
                 for(i = 0; i < nSize; i += 2)
                 {
                     /* get the references to the left and right leaves in the merkle tree */
-                    uint512_t &left_tx  = vMerkleTree[j+i];
-                    uint512_t &right_tx = vMerkleTree[j + std::min(i+1, nSize-1)];
+                    const uint512_t &left_tx  = vMerkleTree[j+i];
+                    const uint512_t &right_tx = vMerkleTree[j + std::min(i+1, nSize-1)];
 
-                    vMerkleTree.push_back(LLC::SK512(BEGIN(left_tx),  END(left_tx),
-                                                     BEGIN(right_tx), END(right_tx)));
+                    std::copy(BEGIN(left_tx),  END(left_tx),  (char*)&vPairs[i * 64]);
+                    std::copy(BEGIN(right_tx), END(right_tx), (char*)&vPairs[i * 64 + 64]);
                 }
+
+                /* Hash the next level in parallel lanes. */
+                vMerkleTree.resize(j + nSize + nPairs);
+                LLC::SK512Batch(&vPairs[0], 128, nPairs, &vMerkleTree[j + nSize]);
+
                 j += nSize;
             }
             return (vMerkleTree.empty() ? 0 : vMerkleTree.back());
@@ -462,23 +474,21 @@ namespace TAO
         /* Generates the StakeHash for this block from a uint256_t hashGenesis*/
         uint1024_t Block::StakeHash(const uint256_t& hashGenesis) const
         {
-            /* Create a data stream to get the hash. */
-            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-            ss.reserve(256);
+            /* Create a hash writer to get the hash. */
+            LLC::SKHashWriter<1024> ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
 
             /* Serialize the data to hash into a stream. */
             ss << nVersion << hashPrevBlock << nChannel << nHeight << nBits << hashGenesis << nNonce;
 
-            return LLC::SK1024(ss.begin(), ss.end());
+            return ss.GetHash();
         }
 
 
         /* Generates the StakeHash for this block from a uint256_t hashGenesis*/
         uint1024_t Block::StakeHash(bool fGenesis, const uint576_t& hashTrustKey) const
         {
-            /* Create a data stream to get the hash. */
-            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-            ss.reserve(256);
+            /* Create a hash writer to get the hash. */
+            LLC::SKHashWriter<1024> ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
 
             /* Trust Key is part of stake hash if not genesis. */
             if(nHeight > 2392970 && fGenesis)
@@ -489,13 +499,13 @@ namespace TAO
                 /* Serialize the data to hash into a stream. */
                 ss << nVersion << hashPrevBlock << nChannel << nHeight << nBits << hashPrevout << nNonce;
 
-                return LLC::SK1024(ss.begin(), ss.end());
+                return ss.GetHash();
             }
 
             /* Serialize the data to hash into a stream. */
             ss << nVersion << hashPrevBlock << nChannel << nHeight << nBits << hashTrustKey << nNonce;
 
-            return LLC::SK1024(ss.begin(), ss.end());
+            return ss.GetHash();
         }
     }
 }
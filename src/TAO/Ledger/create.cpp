@@ -43,6 +43,7 @@ ________________________________________________________________________________
 
 #include <Util/include/convert.h>
 #include <Util/include/debug.h>
+#include <Util/include/mutex.h>
 #include <Util/include/runtime.h>
 
 /* Global TAO namespace. */
@@ -126,11 +127,39 @@ namespace TAO
         }
 
 
-        /* Gets a list of transactions from memory pool for current block. */
-        void AddTransactions(TAO::Ledger::TritiumBlock& block)
+        /* Mutex guarding the block template. */
+        static std::mutex TEMPLATE_MUTEX;
+
+        /* Best chain the block template was assembled on. */
+        static uint1024_t hashTemplateBest = 0;
+
+        /* Memory pool sequence the block template was assembled from. */
+        static uint64_t nTemplateSequence = 0;
+
+        /* Transactions of the block template, dependents ordered after the transactions they depend on. */
+        static std::vector<std::pair<uint8_t, uint512_t> > vTemplate;
+
+        /* Earliest timestamp of a transaction left out of the block template for being in the future, 0 for none. */
+        static uint64_t nTemplateFuture = 0;
+
+
+        /* Get the serialized size of a block holding a number of transactions, given its size with none. */
+        static uint64_t BlockSize(const uint64_t nBaseSize, const uint64_t nCount)
         {
-            /* Clear the transactions. */
-            block.vtx.clear();
+            /* Size of each transaction entry. */
+            static const uint64_t nEntrySize =
+                ::GetSerializeSize(std::make_pair(uint8_t(0), uint512_t(0)), uint32_t(SER_NETWORK), LLP::PROTOCOL_VERSION);
+
+            /* The empty list serializes as a single byte for its compact size. */
+            return nBaseSize - 1 + GetSizeOfCompactSize(nCount) + nCount * nEntrySize;
+        }
+
+
+        /* Assemble a validated list of transactions from memory pool into the block. */
+        static void AssembleTransactions(TAO::Ledger::TritiumBlock& block, const uint64_t nBaseSize, uint64_t& nFuture)
+        {
+            /* Track the earliest transaction skipped for its timestamp, so the template is rebuilt once it becomes valid. */
+            nFuture = 0;
 
             /* Check the memory pool. */
             std::vector<uint512_t> vMempool;
@@ -146,7 +175,7 @@ namespace TAO
             for(const auto& hash : vMempool)
             {
                 /* Check the Size limits of the Current Block. */
-                if(::GetSerializeSize(block, SER_NETWORK, LLP::PROTOCOL_VERSION) + 256 >= MAX_BLOCK_SIZE)
+                if(BlockSize(nBaseSize, block.vtx.size() + 1) + 256 >= MAX_BLOCK_SIZE)
                     break;
 
                 /* Get the transaction from the memory pool. */
@@ -175,6 +204,9 @@ namespace TAO
                 {
                     setDependents.insert(hash);
 
+                    if(nFuture == 0 || tx.nTimestamp < nFuture)
+                        nFuture = tx.nTimestamp;
+
                     debug::log(2, FUNCTION, "Skipping transaction ", hash.SubString(), " - timesamp too far in future");
                     continue;
                 }
@@ -238,7 +270,7 @@ namespace TAO
             for(const auto& hash : vMempool)
             {
                 /* Check the Size limits of the Current Block. */
-                if(::GetSerializeSize(block, SER_NETWORK, LLP::PROTOCOL_VERSION) + 256 >= MAX_BLOCK_SIZE)
+                if(BlockSize(nBaseSize, block.vtx.size() + 1) + 256 >= MAX_BLOCK_SIZE)
                     break;
 
                 /* Get the transaction from the memory pool. */
@@ -265,7 +297,12 @@ namespace TAO
 
                 /* Check for timestamp violations. */
                 if(tx.nTime > runtime::unifiedtimestamp() + runtime::maxdrift())
+                {
+                    if(nFuture == 0 || tx.nTime < nFuture)
+                        nFuture = tx.nTime;
+
                     continue;
+                }
 
                 /* Retrieve tx inputs */
                 std::map<uint512_t, std::pair<uint8_t, DataStream> > mapInputs;
@@ -300,6 +337,46 @@ namespace TAO
         }
 
 
+        /* Gets a list of transactions from memory pool for current block. */
+        void AddTransactions(TAO::Ledger::TritiumBlock& block)
+        {
+            /* Clear the transactions. */
+            block.vtx.clear();
+
+            /* Get the size of the block with no transactions. */
+            const uint64_t nBaseSize = ::GetSerializeSize(block, SER_NETWORK, LLP::PROTOCOL_VERSION);
+
+            LOCK(TEMPLATE_MUTEX);
+
+            /* Read the chain and pool state before assembling, so changes made while we work make the template stale. */
+            const uint1024_t hashBest = ChainState::hashBestChain.load();
+            const uint64_t nSequence  = mempool.Sequence();
+
+            /* Reassemble the template when the best chain or memory pool have changed, or a skipped transaction is now in time. */
+            if(hashBest != hashTemplateBest || nSequence != nTemplateSequence
+            || (nTemplateFuture != 0 && nTemplateFuture <= runtime::unifiedtimestamp() + runtime::maxdrift()))
+            {
+                AssembleTransactions(block, nBaseSize, nTemplateFuture);
+
+                /* Keep the template for the next block requested. */
+                vTemplate         = block.vtx;
+                hashTemplateBest  = hashBest;
+                nTemplateSequence = nSequence;
+
+                return;
+            }
+
+            /* Copy the template, leaving off any transactions from the end that don't fit in this block. */
+            uint64_t nCount = vTemplate.size();
+            while(nCount > 0 && BlockSize(nBaseSize, nCount) + 256 >= MAX_BLOCK_SIZE)
+                --nCount;
+
+            block.vtx.assign(vTemplate.begin(), vTemplate.begin() + nCount);
+
+            debug::log(3, FUNCTION, "Using block template with ", nCount, " transactions");
+        }
+
+
         /* Populate block header data for a new block. */
         void AddBlockData(const TAO::Ledger::BlockState& stateBest, const uint32_t nChannel, TAO::Ledger::TritiumBlock& block)
         {
@@ -52,7 +52,8 @@ namespace TAO
 
         /** AddTransactions
          *
-         *  Gets a list of transactions from memory pool for current block.
+         *  Gets a list of transactions from memory pool for current block. The validated list is kept as a
+         *  template and copied into later blocks until the best chain or memory pool changes.
          *
          *  @param[out] block The block to add the transactions to.
          *
@@ -19,9 +19,9 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/types/block.h>
 
-#include <map>
 #include <mutex>
 #include <memory>
+#include <unordered_map>
 
 /* Global TAO namespace. */
 namespace TAO
@@ -47,7 +47,7 @@ namespace TAO
 
 
         /** Static instantiation of orphan blocks in queue to process. **/
-        extern std::map<uint1024_t, std::unique_ptr<TAO::Ledger::Block>> mapOrphans;
+        extern std::unordered_map<uint1024_t, std::unique_ptr<TAO::Ledger::Block>> mapOrphans;
 
 
         /** Mutex to protect checking more than one block at a time. **/
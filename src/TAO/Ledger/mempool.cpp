@@ -51,6 +51,8 @@ namespace TAO
         , mapClaimed         ( )
         , mapInputs          ( )
         , setOrphansByIndex  ( )
+        , mapGenesis         ( )
+        , nSequence          (0)
         {
         }
 
@@ -75,6 +77,12 @@ namespace TAO
 
             /* Add to the map. */
             mapLedger[hashTx] = tx;
+            IndexGenesis(hashTx, tx);
+            ++nSequence;
+
+            /* Update map claimed if not first tx. */
+            if(!tx.IsFirst())
+                mapClaimed[tx.hashPrevTx] = hashTx;
 
             return true;
         }
@@ -184,6 +192,8 @@ namespace TAO
 
             /* Set the internal memory. */
             mapLedger[hashTx] = tx;
+            IndexGenesis(hashTx, tx);
+            ++nSequence;
 
             /* Update map claimed if not first tx. */
             if(!tx.IsFirst())
@@ -302,38 +312,27 @@ namespace TAO
         {
             RLOCK(MUTEX);
 
-            /* Check through the ledger map for the genesis. */
-            for(const auto& tx : mapLedger)
-            {
-                /* Check for non-conflicted genesis-id's. */
-                if(tx.second.hashGenesis == hashGenesis)
-                    vtx.push_back(tx.second);
-            }
-
-            /* Check that a transaction was found. */
-            if(vtx.size() == 0)
+            /* Find the pending transactions for the genesis. */
+            const auto it = mapGenesis.find(hashGenesis);
+            if(it == mapGenesis.end())
                 return false;
 
-            /* Sort the list by sequence numbers. */
-            std::sort(vtx.begin(), vtx.end());
-
-            /* Check that the mempool transactions are in correct order. */
-            uint512_t hashLast = vtx[0].GetHash();
-            for(uint32_t n = 1; n < vtx.size(); ++n)
+            /* Add the transactions while they are in sequence. */
+            const std::vector<uint512_t>& vHashes = it->second;
+            for(uint32_t n = 0; n < vHashes.size(); ++n)
             {
+                /* Get the transaction from the ledger map. */
+                const TAO::Ledger::Transaction& tx = mapLedger.at(vHashes[n]);
+
                 /* Check that transaction is in sequence. */
-                if(vtx[n].hashPrevTx != hashLast)
+                if(n > 0 && tx.hashPrevTx != vHashes[n - 1])
                 {
                     debug::log(0, FUNCTION, "Last hash mismatch");
 
-                    /* Resize to forget about mismatched sequences. */
-                    vtx.resize(n);
-
                     break;
                 }
 
-                /* Set last hash. */
-                hashLast = vtx[n].GetHash();
+                vtx.push_back(tx);
             }
 
             return (vtx.size() > 0);
@@ -343,13 +342,32 @@ namespace TAO
         /* Gets a transaction by genesis. */
         bool Mempool::Get(const uint256_t& hashGenesis, TAO::Ledger::Transaction &tx) const
         {
-            /* Get the list of transactions by genesis. */
-            std::vector<TAO::Ledger::Transaction> vtx;
-            if(!Get(hashGenesis, vtx))
+            RLOCK(MUTEX);
+
+            /* Find the pending transactions for the genesis. */
+            const auto it = mapGenesis.find(hashGenesis);
+            if(it == mapGenesis.end())
                 return false;
 
-            /* Return last item in list (newest). */
-            tx = vtx.back();
+            /* Walk to the last transaction that is in sequence. */
+            const std::vector<uint512_t>& vHashes = it->second;
+
+            uint32_t nLast = 0;
+            for(uint32_t n = 1; n < vHashes.size(); ++n)
+            {
+                /* Check that transaction is in sequence. */
+                if(mapLedger.at(vHashes[n]).hashPrevTx != vHashes[n - 1])
+                {
+                    debug::log(0, FUNCTION, "Last hash mismatch");
+
+                    break;
+                }
+
+                nLast = n;
+            }
+
+            /* Return last item in sequence (newest). */
+            tx = mapLedger.at(vHashes[nLast]);
 
             return true;
         }
@@ -369,12 +387,7 @@ namespace TAO
         {
             RLOCK(MUTEX);
 
-            /* Check through the ledger map for the genesis. */
-            for(const auto& tx : mapLedger)
-                if(tx.second.hashGenesis == hashGenesis)
-                    return true;
-
-            return false;
+            return mapGenesis.count(hashGenesis);
         }
 
 
@@ -404,7 +417,9 @@ namespace TAO
                 /* Erase from the memory map. */
                 mapClaimed.erase(tx.hashPrevTx);
                 mapOrphans.erase(tx.hashPrevTx);
+                EraseGenesis(hashTx, tx);
                 mapLedger.erase(hashTx);
+                ++nSequence;
 
                 return true;
             }
@@ -420,6 +435,7 @@ namespace TAO
                     mapInputs.erase(tx.vin[i].prevout);
 
                 mapLegacy.erase(hashTx);
+                ++nSequence;
             }
 
             return false;
@@ -433,73 +449,58 @@ namespace TAO
 
             //TODO: evict conflicted transctions from mempool
 
-            /* Create map of transactions by genesis. */
-            std::map<uint256_t, std::vector<TAO::Ledger::Transaction> > mapTransactions;
-
-            /* Loop through all the transactions. */
-            for(const auto& tx : mapLedger)
-            {
-                /* Cache the genesis. */
-                const uint256_t& hashGenesis = tx.second.hashGenesis;
-
-                /* Check in map for push back. */
-                if(!mapTransactions.count(hashGenesis))
-                    mapTransactions[hashGenesis] = std::vector<TAO::Ledger::Transaction>();
-
-                /* Push to back of map. */
-                mapTransactions[hashGenesis].push_back(tx.second);
-            }
+            /* Copy the pending transactions by genesis, since orphans found are removed from the index as we go. */
+            const std::vector<std::pair<uint256_t, std::vector<uint512_t> > > vChains(mapGenesis.begin(), mapGenesis.end());
 
-            /* Loop transctions map by genesis. */
-            for(auto& list : mapTransactions)
+            /* Loop transctions by genesis. */
+            for(const auto& list : vChains)
             {
-                /* Get reference of the vector. */
-                std::vector<TAO::Ledger::Transaction>& vtx = list.second;
-
-                /* Sort the list by sequence numbers. */
-                std::sort(vtx.begin(), vtx.end());
+                /* Get reference of the hashes, ordered by sequence. */
+                const std::vector<uint512_t>& vHashes = list.second;
 
                 /* Add the hashes into list. */
                 uint512_t hashLast = 0;
 
                 /* Check last hash for valid transactions. */
-                if(!vtx[0].IsFirst())
+                const TAO::Ledger::Transaction& txFirst = mapLedger.at(vHashes[0]);
+                if(!txFirst.IsFirst())
                 {
                     /* Read last hash. */
                     if(!LLD::Ledger->ReadLast(list.first, hashLast))
                         break;
 
                     /* Check the last hash. */
-                    if(vtx[0].hashPrevTx != hashLast)
+                    if(txFirst.hashPrevTx != hashLast)
                     {
                         /* Debug information. */
-                        debug::error(FUNCTION, "ROOT ORPHAN: last hash mismatch ", vtx[0].hashPrevTx.SubString());
+                        debug::error(FUNCTION, "ROOT ORPHAN: last hash mismatch ", txFirst.hashPrevTx.SubString());
 
                         debug::log(3, "REMOVE ------------------------------");
 
                         /* Disconnect all transactions in reverse order. */
-                        for(auto tx = vtx.rbegin(); tx != vtx.rend(); ++tx)
+                        for(auto hash = vHashes.rbegin(); hash != vHashes.rend(); ++hash)
                         {
+                            /* Copy the transaction, as it is erased from the pool below. */
+                            TAO::Ledger::Transaction tx = mapLedger.at(*hash);
+
                             /* Show the removal. */
-                            tx->print();
+                            tx.print();
 
                             /* Reset memory states to disk indexes. */
-                            if(!tx->Disconnect(FLAGS::ERASE))
+                            if(!tx.Disconnect(FLAGS::ERASE))
                             {
-                                debug::error(FUNCTION, "failed to disconnect tx ", tx->GetHash().SubString());
+                                debug::error(FUNCTION, "failed to disconnect tx ", hash->SubString());
 
                                 break;
                             }
 
-                            /* Find the transaction in pool. */
-                            if(mapLedger.count(tx->GetHash()))
-                            {
-                                debug::log(0, "DELETED ", tx->GetHash().SubString());
+                            debug::log(0, "DELETED ", hash->SubString());
 
-                                /* Erase from the memory map. */
-                                mapClaimed.erase(tx->hashPrevTx);
-                                mapLedger.erase(tx->GetHash());
-                            }
+                            /* Erase from the memory map. */
+                            mapClaimed.erase(tx.hashPrevTx);
+                            EraseGenesis(*hash, tx);
+                            mapLedger.erase(*hash);
+                            ++nSequence;
                         }
 
                         debug::log(3, "END REMOVE ------------------------------");
@@ -510,20 +511,17 @@ namespace TAO
                 }
 
                 /* Set last from next transaction. */
-                hashLast = vtx[0].GetHash();
+                hashLast = vHashes[0];
 
                 /* Loop through transaction by genesis. */
-                for(uint32_t n = 1; n < vtx.size(); ++n)
+                for(uint32_t n = 1; n < vHashes.size(); ++n)
                 {
-                    /* Check for end of index. */
-                    if(n == vtx.size())
-                        break;
-
                     /* Check that transaction is in sequence. */
-                    if(vtx[n].hashPrevTx != hashLast)
+                    const TAO::Ledger::Transaction& txNext = mapLedger.at(vHashes[n]);
+                    if(txNext.hashPrevTx != hashLast)
                     {
                         /* Debug information. */
-                        debug::error(FUNCTION, "ORPHAN DETECTED INDEX ", n, ": last hash mismatch ", vtx[n].hashPrevTx.SubString());
+                        debug::error(FUNCTION, "ORPHAN DETECTED INDEX ", n, ": last hash mismatch ", txNext.hashPrevTx.SubString());
 
                         debug::log(3, "REMOVE ------------------------------");
 
@@ -531,25 +529,27 @@ namespace TAO
                         LLD::TxnBegin(FLAGS::MEMPOOL);
 
                         /* Disconnect all transactions in reverse order. */
-                        for(auto tx = vtx.rbegin(); tx != vtx.rend(); ++tx)
+                        for(auto hash = vHashes.rbegin(); hash != vHashes.rend(); ++hash)
                         {
-                            tx->print();
+                            /* Copy the transaction, as it is erased from the pool below. */
+                            TAO::Ledger::Transaction tx = mapLedger.at(*hash);
+                            tx.print();
 
-                            if(tx->GetHash() == hashLast)
+                            if(*hash == hashLast)
                             {
                                 debug::log(0, "REACHED HASH LAST");
                                 break;
                             }
 
                             /* Reset memory states to disk indexes. */
-                            if(!tx->Disconnect(FLAGS::MEMPOOL))
+                            if(!tx.Disconnect(FLAGS::MEMPOOL))
                             {
                                 LLD::TxnAbort(FLAGS::MEMPOOL);
 
                                 break;
                             }
 
-                            Remove(tx->GetHash());
+                            Remove(*hash);
                         }
 
                         /* Commit the memory transaction. */
@@ -562,7 +562,7 @@ namespace TAO
                     }
 
                     /* Set last hash. */
-                    hashLast = vtx[n].GetHash();
+                    hashLast = vHashes[n];
                 }
             }
         }
@@ -578,53 +578,30 @@ namespace TAO
             /* If legacy flag set, skip over getting tritium transactions. */
             if(!fLegacy)
             {
-                /* Create map of transactions by genesis. */
-                std::map<uint256_t, std::vector<TAO::Ledger::Transaction> > mapTransactions;
-
-                /* Loop through all the transactions. */
-                for(const auto& tx : mapLedger)
+                /* Loop transctions by genesis. */
+                for(const auto& list : mapGenesis)
                 {
-                    /* Check that this transaction isn't conflicted. */
-                    //if(mapConflicts.count(tx.first))
-                    //    continue;
-
-                    /* Cache the genesis. */
-                    const uint256_t& hashGenesis = tx.second.hashGenesis;
-
-                    /* Check in map for push back. */
-                    if(!mapTransactions.count(hashGenesis))
-                        mapTransactions[hashGenesis] = std::vector<TAO::Ledger::Transaction>();
-
-                    /* Push to back of map. */
-                    mapTransactions[hashGenesis].push_back(tx.second);
-                }
-
-                /* Loop transctions map by genesis. */
-                for(auto& list : mapTransactions)
-                {
-                    /* Get reference of the vector. */
-                    std::vector<TAO::Ledger::Transaction>& vtx = list.second;
-
-                    /* Sort the list by sequence numbers. */
-                    std::sort(vtx.begin(), vtx.end());
+                    /* Get reference of the hashes, ordered by sequence. */
+                    const std::vector<uint512_t>& vtx = list.second;
 
                     /* Add the hashes into list. */
                     uint512_t hashLast = 0;
 
                     /* Check last hash for valid transactions. */
-                    if(!vtx[0].IsFirst())
+                    const TAO::Ledger::Transaction& txFirst = mapLedger.at(vtx[0]);
+                    if(!txFirst.IsFirst())
                     {
                         /* Read last index from disk. */
                         if(!LLD::Ledger->ReadLast(list.first, hashLast))
                             break; //NOTE: this may need an error
 
                         /* Check the last hash. */
-                        if(vtx[0].hashPrevTx != hashLast)
+                        if(txFirst.hashPrevTx != hashLast)
                             break;
                     }
 
                     /* Set last from next transaction. */
-                    hashLast = vtx[0].GetHash();
+                    hashLast = vtx[0];
 
                     /* Loop through transaction by genesis. */
                     for(uint32_t n = 1; n <= vtx.size(); ++n)
@@ -641,11 +618,11 @@ namespace TAO
                             return true;
 
                         /* Check that transaction is in sequence. */
-                        if(vtx[n].hashPrevTx != hashLast)
+                        if(mapLedger.at(vtx[n]).hashPrevTx != hashLast)
                             break; //SKIP ANY ORPHANS FOUND
 
                         /* Set last hash. */
-                        hashLast = vtx[n].GetHash();
+                        hashLast = vtx[n];
                     }
                 }
             }
@@ -674,5 +651,45 @@ namespace TAO
 
             return static_cast<uint32_t>(mapLedger.size() + mapLegacy.size());
         }
+
+
+        /* Add a transaction to the pending transactions of its signature chain. */
+        void Mempool::IndexGenesis(const uint512_t& hashTx, const TAO::Ledger::Transaction& tx)
+        {
+            std::vector<uint512_t>& vHashes = mapGenesis[tx.hashGenesis];
+
+            /* Insert after any pending transaction with a lower or equal sequence, searching from the end since
+               transactions tend to arrive in order. */
+            auto it = vHashes.end();
+            while(it != vHashes.begin() && mapLedger.at(*(it - 1)).nSequence > tx.nSequence)
+                --it;
+
+            vHashes.insert(it, hashTx);
+        }
+
+
+        /* Remove a transaction from the pending transactions of its signature chain. */
+        void Mempool::EraseGenesis(const uint512_t& hashTx, const TAO::Ledger::Transaction& tx)
+        {
+            /* Find the pending transactions for the genesis. */
+            auto it = mapGenesis.find(tx.hashGenesis);
+            if(it == mapGenesis.end())
+                return;
+
+            /* Erase the transaction from the list. */
+            std::vector<uint512_t>& vHashes = it->second;
+            vHashes.erase(std::remove(vHashes.begin(), vHashes.end(), hashTx), vHashes.end());
+
+            /* Drop the genesis once it has nothing pending. */
+            if(vHashes.empty())
+                mapGenesis.erase(it);
+        }
+
+
+        /* Gets a counter that changes whenever a transaction is added to or removed from the pool. */
+        uint64_t Mempool::Sequence() const
+        {
+            return nSequence.load();
+        }
     }
 }
@@ -26,7 +26,7 @@ namespace TAO
     namespace Ledger
     {
         /* Static instantiation of orphan blocks in queue to process. */
-        std::map<uint1024_t, std::unique_ptr<TAO::Ledger::Block>> mapOrphans;
+        std::unordered_map<uint1024_t, std::unique_ptr<TAO::Ledger::Block>> mapOrphans;
 
 
         /* Mutex to protect checking more than one block at a time. */
@@ -16,6 +16,7 @@ ________________________________________________________________________________
 #include <LLC/hash/macro.h>
 #include <LLC/hash/argon2.h>
 
+#include <LLC/include/argon2_pool.h>
 #include <LLC/include/flkey.h>
 #include <LLC/include/eckey.h>
 
@@ -128,15 +129,15 @@ namespace TAO
                 /* Algorithm Version */
                 ARGON2_VERSION_13,
 
-                /* Custom memory allocation / deallocation functions. */
+                /* Memory is allocated from the argon2 pool arenas. */
                 NULL, NULL,
 
                 /* By default only internal memory is cleared (pwd is not wiped) */
                 ARGON2_DEFAULT_FLAGS
             };
 
-            /* Run the argon2 computation. */
-            int32_t nRet = argon2id_ctx(&context);
+            /* Run the argon2 computation on one of our shared arenas. */
+            int32_t nRet = LLC::Argon2Pool::GetInstance().Hash(context);
             if(nRet != ARGON2_OK)
                 throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
 
@@ -227,15 +228,15 @@ namespace TAO
                 /* Algorithm Version */
                 ARGON2_VERSION_13,
 
-                /* Custom memory allocation / deallocation functions. */
+                /* Memory is allocated from the argon2 pool arenas. */
                 NULL, NULL,
 
                 /* By default only internal memory is cleared (pwd is not wiped) */
                 ARGON2_DEFAULT_FLAGS
             };
 
-            /* Run the argon2 computation. */
-            int nRet = argon2id_ctx(&context);
+            /* Run the argon2 computation on one of our shared arenas. */
+            int32_t nRet = LLC::Argon2Pool::GetInstance().Hash(context);
             if(nRet != ARGON2_OK)
                 throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
 
@@ -315,15 +316,15 @@ namespace TAO
                 /* Algorithm Version */
                 ARGON2_VERSION_13,
 
-                /* Custom memory allocation / deallocation functions. */
+                /* Memory is allocated from the argon2 pool arenas. */
                 NULL, NULL,
 
                 /* By default only internal memory is cleared (pwd is not wiped) */
                 ARGON2_DEFAULT_FLAGS
             };
 
-            /* Run the argon2 computation. */
-            int nRet = argon2id_ctx(&context);
+            /* Run the argon2 computation on one of our shared arenas. */
+            int32_t nRet = LLC::Argon2Pool::GetInstance().Hash(context);
             if(nRet != ARGON2_OK)
                 throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
 
@@ -398,15 +399,15 @@ namespace TAO
                 /* Algorithm Version */
                 ARGON2_VERSION_13,
 
-                /* Custom memory allocation / deallocation functions. */
+                /* Memory is allocated from the argon2 pool arenas. */
                 NULL, NULL,
 
                 /* By default only internal memory is cleared (pwd is not wiped) */
                 ARGON2_DEFAULT_FLAGS
             };
 
-            /* Run the argon2 computation. */
-            int nRet = argon2id_ctx(&context);
+            /* Run the argon2 computation on one of our shared arenas. */
+            int32_t nRet = LLC::Argon2Pool::GetInstance().Hash(context);
             if(nRet != ARGON2_OK)
                 throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
 
@@ -463,15 +464,15 @@ namespace TAO
                 /* Algorithm Version */
                 ARGON2_VERSION_13,
 
-                /* Custom memory allocation / deallocation functions. */
+                /* Memory is allocated from the argon2 pool arenas. */
                 NULL, NULL,
 
                 /* By default only internal memory is cleared (pwd is not wiped) */
                 ARGON2_DEFAULT_FLAGS
             };
 
-            /* Run the argon2 computation. */
-            int32_t nRet = argon2id_ctx(&context);
+            /* Run the argon2 computation on one of our shared arenas. */
+            int32_t nRet = LLC::Argon2Pool::GetInstance().Hash(context);
             if(nRet != ARGON2_OK)
                 throw std::runtime_error(debug::safe_printstr(FUNCTION, "Argon2 failed with code ", nRet));
 
@@ -14,6 +14,7 @@ ________________________________________________________________________________
 #include <TAO/Ledger/include/stake_change.h>
 
 #include <LLC/hash/SK.h>
+#include <LLC/hash/writer.h>
 #include <LLP/include/version.h>
 #include <Util/include/runtime.h>
 #include <Util/templates/datastream.h>
@@ -128,13 +129,13 @@ namespace TAO
         /* Get the hash for the stake change request. */
         uint256_t StakeChange::GetHash() const
         {
-            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
+            LLC::SKHashWriter<256> ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
 
             /* Hash the static data for the change request */
             ss << nVersion << hashGenesis << nAmount << hashLast << nTime << nExpires;
 
             /* Get the hash. */
-            uint256_t hash = LLC::SK256(ss.begin(), ss.end());
+            uint256_t hash = ss.GetHash();
 
             return hash;
         }
@@ -15,6 +15,8 @@ ________________________________________________________________________________
 
 #include <string>
 
+#include <LLC/hash/writer.h>
+
 #include <LLD/include/global.h>
 #include <LLP/include/global.h>
 #include <LLP/include/inv.h>
@@ -1383,24 +1385,22 @@ namespace TAO
             /* Signature hash for version 7 blocks. */
             if(nVersion >= 7)
             {
-                /* Create a data stream to get the hash. */
-                DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-                ss.reserve(256);
+                /* Create a hash writer to get the hash. */
+                LLC::SKHashWriter<1024> ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
 
                 /* Serialize the data to hash into a stream. */
                 ss << nVersion << hashPrevBlock << hashMerkleRoot << nChannel << nHeight << nBits << nNonce << nTime << vOffsets;
 
-                return LLC::SK1024(ss.begin(), ss.end());
+                return ss.GetHash();
             }
 
-            /* Create a data stream to get the hash. */
-            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-            ss.reserve(256);
+            /* Create a hash writer to get the hash. */
+            LLC::SKHashWriter<1024> ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
 
             /* Serialize the data to hash into a stream. */
             ss << nVersion << hashPrevBlock << hashMerkleRoot << nChannel << nHeight << nBits << nNonce << uint32_t(nTime);
 
-            return LLC::SK1024(ss.begin(), ss.end());
+            return ss.GetHash();
         }
 
 
@@ -13,6 +13,7 @@ ________________________________________________________________________________
 
 
 #include <LLC/hash/SK.h>
+#include <LLC/hash/writer.h>
 #include <LLC/hash/macro.h>
 #include <LLC/hash/argon2.h>
 
@@ -1038,11 +1039,11 @@ namespace TAO
         /* Gets the hash of the transaction object. */
         uint512_t Transaction::GetHash() const
         {
-            DataStream ss(SER_GETHASH, nVersion);
+            LLC::SKHashWriter<512> ss(SER_GETHASH, nVersion);
             ss << *this;
 
             /* Get the hash. */
-            uint512_t hash = LLC::SK512(ss.begin(), ss.end());
+            uint512_t hash = ss.GetHash();
 
             /* Type of 0xff designates tritium tx. */
             hash.SetType(TAO::Ledger::TRITIUM);
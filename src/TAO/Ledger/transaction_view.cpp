@@ -0,0 +1,137 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/Ledger/types/transaction_view.h>
+
+#include <Util/include/debug.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /* Skip over a serialized byte vector. */
+        static void SkipBytes(const DataStream& s)
+        {
+            const uint64_t nSize = ReadCompactSize(s);
+            if(nSize > s.size() - s.GetPos())
+                throw debug::exception(FUNCTION, "stream size ", nSize, " out of bounds");
+
+            s.SetPos(s.GetPos() + nSize);
+        }
+
+
+        /* Constructor. */
+        TransactionView::TransactionView(const uint512_t& hashTxIn)
+        : vContracts   ( )
+        , vOffsets     ( )
+        , mapContracts ( )
+        , nSerType     (0)
+        , nSerVersion  (0)
+        , hashTx       (hashTxIn)
+        , nVersion     (0)
+        , nSequence    (0)
+        , nTimestamp   (0)
+        , hashNext     (0)
+        , hashRecovery (0)
+        , hashGenesis  (0)
+        , hashPrevTx   (0)
+        , nKeyType     (0)
+        , nNextType    (0)
+        {
+        }
+
+
+        /* Reads a serialized Transaction, skipping over the contracts and signature data. */
+        void TransactionView::Unserialize(const DataStream& s, uint32_t nSerTypeIn, uint32_t nSerVersionIn)
+        {
+            /* Contracts are decoded later with the same serialization. */
+            nSerType    = nSerTypeIn;
+            nSerVersion = nSerVersionIn;
+
+            /* Find where each contract starts by skipping over its three streams. */
+            const uint64_t nContracts = ReadCompactSize(s);
+            const uint64_t nBegin     = s.GetPos();
+
+            vOffsets.clear();
+            mapContracts.clear();
+            for(uint64_t nContract = 0; nContract < nContracts; ++nContract)
+            {
+                vOffsets.push_back(s.GetPos() - nBegin);
+
+                SkipBytes(s); //operation
+                SkipBytes(s); //condition
+                SkipBytes(s); //register
+            }
+            vOffsets.push_back(s.GetPos() - nBegin);
+
+            /* Keep the contract bytes for decoding later. */
+            vContracts.assign(s.begin() + nBegin, s.begin() + s.GetPos());
+
+            /* Ledger layer */
+            ::Unserialize(s, nVersion,     nSerType, nSerVersion);
+            ::Unserialize(s, nSequence,    nSerType, nSerVersion);
+            ::Unserialize(s, nTimestamp,   nSerType, nSerVersion);
+            ::Unserialize(s, hashNext,     nSerType, nSerVersion);
+            ::Unserialize(s, hashRecovery, nSerType, nSerVersion);
+            ::Unserialize(s, hashGenesis,  nSerType, nSerVersion);
+            ::Unserialize(s, hashPrevTx,   nSerType, nSerVersion);
+            ::Unserialize(s, nKeyType,     nSerType, nSerVersion);
+            ::Unserialize(s, nNextType,    nSerType, nSerVersion);
+
+            /* Check for skipping public key. */
+            if(!(nSerType & SER_GETHASH) && !(nSerType & SER_SKIPPUB))
+                SkipBytes(s);
+
+            /* Handle for when not getting hash or skipsig. */
+            if(!(nSerType & SER_GETHASH) && !(nSerType & SER_SKIPSIG))
+                SkipBytes(s);
+        }
+
+
+        /* Get the total contracts in the transaction. */
+        uint32_t TransactionView::Size() const
+        {
+            return vOffsets.empty() ? 0 : static_cast<uint32_t>(vOffsets.size() - 1);
+        }
+
+
+        /* Access a contract, decoding it the first time it is requested. */
+        const TAO::Operation::Contract& TransactionView::operator[](const uint32_t n) const
+        {
+            /* Check contract bounds. */
+            if(n >= Size())
+                throw debug::exception(FUNCTION, "contract read out of bounds");
+
+            /* Check for an already decoded contract. */
+            auto it = mapContracts.find(n);
+            if(it != mapContracts.end())
+                return it->second;
+
+            /* Decode just this contract's bytes. */
+            const char* pBegin = reinterpret_cast<const char*>(vContracts.data());
+            DataStream ssContract(pBegin + vOffsets[n], pBegin + vOffsets[n + 1], nSerType, nSerVersion);
+
+            TAO::Operation::Contract contract;
+            ssContract >> contract;
+
+            /* Bind with the txid we were read with rather than hashing the transaction. */
+            contract.Bind(hashGenesis, nTimestamp, hashTx, nVersion);
+
+            return mapContracts.emplace(n, std::move(contract)).first->second;
+        }
+    }
+}
@@ -11,6 +11,7 @@
 
 ____________________________________________________________________________________________*/
 
+#include <LLC/hash/writer.h>
 #include <LLC/types/bignum.h>
 
 #include <LLD/include/global.h>
@@ -832,14 +833,13 @@ namespace TAO
         /* Get the Signarture Hash of the block. Used to verify work claims. */
         uint1024_t TritiumBlock::SignatureHash() const
         {
-            /* Create a data stream to get the hash. */
-            DataStream ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
-            ss.reserve(256);
+            /* Create a hash writer to get the hash. */
+            LLC::SKHashWriter<1024> ss(SER_GETHASH, LLP::PROTOCOL_VERSION);
 
             /* Serialize the data to hash into a stream. */
             ss << nVersion << hashPrevBlock << hashMerkleRoot << nChannel << nHeight << nBits << nNonce << nTime << vOffsets;
 
-            return LLC::SK1024(ss.begin(), ss.end());
+            return ss.GetHash();
         }
 
 
@@ -848,5 +848,28 @@ namespace TAO
         {
             return Block::StakeHash(producer.hashGenesis);
         }
+
+
+        /* Search nonces from the current one for a stake hash meeting the target. */
+        bool TritiumBlock::StakeSearch(const uint1024_t& hashTarget, const uint64_t nLastNonce, uint1024_t &hashProof)
+        {
+            /* Hash the stake data ahead of the nonce once, the same as Block::StakeHash. */
+            LLC::SKHashWriter<1024> ssPrefix(SER_GETHASH, LLP::PROTOCOL_VERSION);
+            ssPrefix << nVersion << hashPrevBlock << nChannel << nHeight << nBits << producer.hashGenesis;
+
+            /* Finish a copy of the midstate with each nonce. */
+            for( ; nNonce <= nLastNonce; ++nNonce)
+            {
+                LLC::SKHashWriter<1024> ss(ssPrefix);
+                ss << nNonce;
+
+                /* Check the hash against the target. */
+                hashProof = ss.GetHash();
+                if(hashProof <= hashTarget)
+                    return true;
+            }
+
+            return false;
+        }
     }
 }
@@ -790,23 +790,30 @@ namespace TAO
                     continue;
                 }
 
-                /* Log every 1000 attempts */
-                if(block.nNonce % 1000 == 0)
-                    debug::log(3, FUNCTION, "Threshold ", nThreshold, " exceeds required ",
-                        nRequired,", mining Proof of Stake with nonce ", block.nNonce);
+                /* Work in batches of 1000 nonces. Threshold only falls as the nonce rises, so binary search for the last one meeting it. */
+                uint64_t nFirstNonce = block.nNonce;
+                uint64_t nLastNonce  = block.nNonce + 999;
+                while(nFirstNonce < nLastNonce)
+                {
+                    const uint64_t nMiddle = nFirstNonce + (nLastNonce - nFirstNonce + 1) / 2;
+                    if(GetCurrentThreshold(nBlockTime, nMiddle) < nRequired)
+                        nLastNonce = nMiddle - 1;
+                    else
+                        nFirstNonce = nMiddle;
+                }
+
+                debug::log(3, FUNCTION, "Threshold ", nThreshold, " exceeds required ",
+                    nRequired,", mining Proof of Stake with nonces ", block.nNonce, " to ", nLastNonce);
 
                 /* Handle if block is found. */
-                uint1024_t hashProof = block.StakeHash();
-                if(hashProof <= nHashTarget)
+                uint1024_t hashProof = 0;
+                if(block.StakeSearch(nHashTarget, nLastNonce, hashProof))
                 {
                     debug::log(0, FUNCTION, "Found new stake hash ", hashProof.SubString());
 
                     ProcessBlock(user, strPIN);
                     break;
                 }
-
-                /* Increment nonce for next iteration. */
-                ++block.nNonce;
             }
 
             return;
@@ -26,6 +26,10 @@ ________________________________________________________________________________
 
 #include <Util/include/mutex.h>
 
+#include <atomic>
+#include <unordered_map>
+#include <unordered_set>
+
 namespace LLP
 {
     class TritiumNode;
@@ -55,35 +59,65 @@ namespace TAO
         private:
 
             /** The transactions in the ledger memory pool. **/
-            std::map<uint512_t, Legacy::Transaction> mapLegacy;
+            std::unordered_map<uint512_t, Legacy::Transaction> mapLegacy;
 
 
             /** The transactions in conflicted legacy memory pool. */
-            std::map<uint512_t, Legacy::Transaction> mapLegacyConflicts;
+            std::unordered_map<uint512_t, Legacy::Transaction> mapLegacyConflicts;
 
 
             /** The transactions in the ledger memory pool. **/
-            std::map<uint512_t, TAO::Ledger::Transaction> mapLedger;
+            std::unordered_map<uint512_t, TAO::Ledger::Transaction> mapLedger;
 
 
             /** The transactions in the conflicted ledger memory pool. **/
-            std::map<uint512_t, TAO::Ledger::Transaction> mapConflicts;
+            std::unordered_map<uint512_t, TAO::Ledger::Transaction> mapConflicts;
 
 
             /** Oprhan transactions in queue. **/
-            std::map<uint512_t, TAO::Ledger::Transaction> mapOrphans;
+            std::unordered_map<uint512_t, TAO::Ledger::Transaction> mapOrphans;
 
 
             /** Record of conflicted transactions in mempool. **/
-            std::map<uint512_t, uint512_t> mapClaimed;
+            std::unordered_map<uint512_t, uint512_t> mapClaimed;
 
 
             /** Record of legacy inputs in the mempool. **/
-            std::map<Legacy::OutPoint, uint512_t> mapInputs;
+            std::unordered_map<Legacy::OutPoint, uint512_t> mapInputs;
 
 
             /** Set to keep track of duplicate orphans by index. **/
-            std::set<uint512_t> setOrphansByIndex;
+            std::unordered_set<uint512_t> setOrphansByIndex;
+
+
+            /** Pending transactions of each signature chain, ordered by sequence. **/
+            std::unordered_map<uint256_t, std::vector<uint512_t> > mapGenesis;
+
+
+            /** Count of transactions added to or removed from the pool. **/
+            std::atomic<uint64_t> nSequence;
+
+
+            /** IndexGenesis
+             *
+             *  Add a transaction to the pending transactions of its signature chain.
+             *
+             *  @param[in] hashTx The hash of the transaction, already in the ledger map.
+             *  @param[in] tx The transaction to index.
+             *
+             **/
+            void IndexGenesis(const uint512_t& hashTx, const TAO::Ledger::Transaction& tx);
+
+
+            /** EraseGenesis
+             *
+             *  Remove a transaction from the pending transactions of its signature chain.
+             *
+             *  @param[in] hashTx The hash of the transaction.
+             *  @param[in] tx The transaction to remove.
+             *
+             **/
+            void EraseGenesis(const uint512_t& hashTx, const TAO::Ledger::Transaction& tx);
 
         public:
 
@@ -326,6 +360,15 @@ namespace TAO
              *
              **/
             uint32_t SizeLegacy();
+
+
+            /** Sequence
+             *
+             *  Gets a counter that changes whenever a transaction is added to or removed from the pool,
+             *  so that anything built from the pool contents can tell when it is stale.
+             *
+             **/
+            uint64_t Sequence() const;
         };
 
         extern Mempool mempool;
@@ -0,0 +1,146 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_LEDGER_TYPES_TRANSACTION_VIEW_H
+#define NEXUS_TAO_LEDGER_TYPES_TRANSACTION_VIEW_H
+
+#include <TAO/Operation/types/contract.h>
+
+#include <Util/templates/datastream.h>
+
+#include <map>
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Ledger Layer namespace. */
+    namespace Ledger
+    {
+
+        /** TransactionView
+         *
+         *  A read only view of a serialized Tritium Transaction.
+         *  Reading it only records where each contract starts and reads the ledger layer, contracts
+         *  are decoded on first access and bound to the txid the view was read with, without hashing.
+         *
+         **/
+        class TransactionView
+        {
+            /** The serialized contracts. **/
+            std::vector<uint8_t> vContracts;
+
+
+            /** Offsets of each contract in the serialized contracts, with the end as the last entry. **/
+            std::vector<uint32_t> vOffsets;
+
+
+            /** Contracts decoded so far, by index. **/
+            mutable std::map<uint32_t, TAO::Operation::Contract> mapContracts;
+
+
+            /** The serialization type the view was read with. **/
+            uint32_t nSerType;
+
+
+            /** The serialization version the view was read with. **/
+            uint32_t nSerVersion;
+
+
+        public:
+
+            /** The txid of the transaction. **/
+            uint512_t hashTx;
+
+
+            /** The transaction version. **/
+            uint32_t nVersion;
+
+
+            /** The sequence identifier. **/
+            uint32_t nSequence;
+
+
+            /** The transaction timestamp. **/
+            uint64_t nTimestamp;
+
+
+            /** The nextHash which can claim the signature chain. */
+            uint256_t hashNext;
+
+
+            /** The recovery hash which can be changed only when in recovery mode. */
+            uint256_t hashRecovery;
+
+
+            /** The genesis ID hash. **/
+            uint256_t hashGenesis;
+
+
+            /** The previous transaction. **/
+            uint512_t hashPrevTx;
+
+
+            /** The key type. **/
+            uint8_t nKeyType;
+
+
+            /** The next key type. **/
+            uint8_t nNextType;
+
+
+            /** Constructor
+             *
+             *  @param[in] hashTxIn The txid of the transaction to be read.
+             *
+             **/
+            TransactionView(const uint512_t& hashTxIn);
+
+
+            /** Unserialize
+             *
+             *  Reads a serialized Transaction, skipping over the contracts and signature data.
+             *
+             *  @param[in] s The stream to read from.
+             *  @param[in] nSerTypeIn The serialize type.
+             *  @param[in] nSerVersionIn The serialize version.
+             *
+             **/
+            void Unserialize(const DataStream& s, uint32_t nSerTypeIn, uint32_t nSerVersionIn);
+
+
+            /** Size
+             *
+             *  Get the total contracts in the transaction.
+             *
+             **/
+            uint32_t Size() const;
+
+
+            /** Operator Overload []
+             *
+             *  Access a contract, decoding it the first time it is requested.
+             *
+             *  @param[in] n The contract index.
+             *
+             *  @return The bound contract.
+             *
+             **/
+            const TAO::Operation::Contract& operator[](const uint32_t n) const;
+        };
+    }
+}
+
+#endif
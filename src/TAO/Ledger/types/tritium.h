@@ -225,6 +225,22 @@ namespace TAO
             uint1024_t StakeHash() const;
 
 
+            /** StakeSearch
+             *
+             *  Search nonces from the current one for a stake hash meeting the target. The stake data ahead of
+             *  the nonce is hashed once and each nonce only finishes the hash from that midstate. The block is
+             *  left on the nonce found, or one past the last nonce when none meet the target.
+             *
+             *  @param[in] hashTarget The target the stake hash must not exceed.
+             *  @param[in] nLastNonce The last nonce to try.
+             *  @param[out] hashProof The stake hash of the nonce found.
+             *
+             *  @return true if a nonce meeting the target was found.
+             *
+             **/
+            bool StakeSearch(const uint1024_t& hashTarget, const uint64_t nLastNonce, uint1024_t &hashProof);
+
+
             /** ToString
              *
              *  For debugging Purposes seeing block state data dump
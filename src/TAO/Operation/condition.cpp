@@ -36,6 +36,9 @@ namespace TAO
         , contract              (condition.contract)
         , caller                (condition.caller)
         , vEvaluate             (condition.vEvaluate)
+        , mapRegisters          (condition.mapRegisters)
+        , statePrestate         (condition.statePrestate)
+        , fPrestate             (condition.fPrestate)
         , nCost                 (condition.nCost)
         {
         }
@@ -47,6 +50,9 @@ namespace TAO
         , contract              (std::move(condition.contract))
         , caller                (std::move(condition.caller))
         , vEvaluate             (std::move(condition.vEvaluate))
+        , mapRegisters          (std::move(condition.mapRegisters))
+        , statePrestate         (std::move(condition.statePrestate))
+        , fPrestate             (std::move(condition.fPrestate))
         , nCost                 (std::move(condition.nCost))
         {
         }
@@ -63,6 +69,9 @@ namespace TAO
         , contract              (contractIn)
         , caller                (callerIn)
         , vEvaluate             ( )
+        , mapRegisters          ( )
+        , statePrestate         ( )
+        , fPrestate             (false)
         , nCost                 (nCostIn)
         {
             /* Push base group, which is what contains final return value. */
@@ -1094,7 +1103,7 @@ namespace TAO
                     case OP::REGISTER::MODIFIED:
                     {
                         /* Register state object. */
-                        TAO::Register::State state;
+                        const TAO::Register::State* pstate = nullptr;
 
                         /* Check for register enum. */
                         switch(OPERATION)
@@ -1105,8 +1114,9 @@ namespace TAO
                                 uint256_t hashRegister;
                                 deallocate(hashRegister, vRet);
 
-                                /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                /* Read the register states, only from disk the first time they are used. */
+                                pstate = read_register(hashRegister);
+                                if(!pstate)
                                     return false;
 
                                 /* Check for overflows. */
@@ -1121,18 +1131,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::MODIFIED:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
-                                /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                /* Get the pre-state, only deserialized the first time it is used. */
+                                pstate = &read_prestate();
 
                                 /* Check for overflows. */
                                 if(nCost + 8 < nCost)
@@ -1146,7 +1146,7 @@ namespace TAO
                         }
 
                         /* Set the register value. */
-                        allocate(state.nModified, vRet);
+                        allocate(pstate->nModified, vRet);
 
                         break;
                     }
@@ -1157,7 +1157,7 @@ namespace TAO
                     case OP::REGISTER::CREATED:
                     {
                         /* Register state object. */
-                        TAO::Register::State state;
+                        const TAO::Register::State* pstate = nullptr;
 
                         /* Check for register enum. */
                         switch(OPERATION)
@@ -1168,8 +1168,9 @@ namespace TAO
                                 uint256_t hashRegister;
                                 deallocate(hashRegister, vRet);
 
-                                /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                /* Read the register states, only from disk the first time they are used. */
+                                pstate = read_register(hashRegister);
+                                if(!pstate)
                                     return false;
 
                                 /* Check for overflows. */
@@ -1184,18 +1185,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::CREATED:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
-                                /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                /* Get the pre-state, only deserialized the first time it is used. */
+                                pstate = &read_prestate();
 
                                 /* Check for overflows. */
                                 if(nCost + 8 < nCost)
@@ -1209,7 +1200,7 @@ namespace TAO
                         }
 
                         /* Set the register value. */
-                        allocate(state.nCreated, vRet);
+                        allocate(pstate->nCreated, vRet);
 
                         break;
                     }
@@ -1220,7 +1211,7 @@ namespace TAO
                     case OP::REGISTER::OWNER:
                     {
                         /* Register state object. */
-                        TAO::Register::State state;
+                        const TAO::Register::State* pstate = nullptr;
 
                         /* Check for register enum. */
                         switch(OPERATION)
@@ -1231,8 +1222,9 @@ namespace TAO
                                 uint256_t hashRegister;
                                 deallocate(hashRegister, vRet);
 
-                                /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                /* Read the register states, only from disk the first time they are used. */
+                                pstate = read_register(hashRegister);
+                                if(!pstate)
                                     return false;
 
                                 /* Check for overflows. */
@@ -1247,18 +1239,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::OWNER:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
-                                /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                /* Get the pre-state, only deserialized the first time it is used. */
+                                pstate = &read_prestate();
 
                                 /* Check for overflows. */
                                 if(nCost + 32 < nCost)
@@ -1272,7 +1254,7 @@ namespace TAO
                         }
 
                         /* Set the register value. */
-                        allocate(state.hashOwner, vRet);
+                        allocate(pstate->hashOwner, vRet);
 
                         break;
                     }
@@ -1283,7 +1265,7 @@ namespace TAO
                     case OP::REGISTER::TYPE:
                     {
                         /* Register state object. */
-                        TAO::Register::State state;
+                        const TAO::Register::State* pstate = nullptr;
 
                         /* Check for register enum. */
                         switch(OPERATION)
@@ -1294,8 +1276,9 @@ namespace TAO
                                 uint256_t hashRegister;
                                 deallocate(hashRegister, vRet);
 
-                                /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                /* Read the register states, only from disk the first time they are used. */
+                                pstate = read_register(hashRegister);
+                                if(!pstate)
                                     return false;
 
                                 /* Check for overflows. */
@@ -1310,18 +1293,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::TYPE:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
-                                /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                /* Get the pre-state, only deserialized the first time it is used. */
+                                pstate = &read_prestate();
 
                                 /* Check for overflows. */
                                 if(nCost + 1 < nCost)
@@ -1335,7 +1308,7 @@ namespace TAO
                         }
 
                         /* Push the type onto the return value. */
-                        allocate(state.nType, vRet);
+                        allocate(pstate->nType, vRet);
 
                         break;
                     }
@@ -1346,7 +1319,7 @@ namespace TAO
                     case OP::REGISTER::STATE:
                     {
                         /* Register state object. */
-                        TAO::Register::State state;
+                        const TAO::Register::State* pstate = nullptr;
 
                         /* Check for register enum. */
                         switch(OPERATION)
@@ -1357,12 +1330,13 @@ namespace TAO
                                 uint256_t hashRegister;
                                 deallocate(hashRegister, vRet);
 
-                                /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, state))
+                                /* Read the register states, only from disk the first time they are used. */
+                                pstate = read_register(hashRegister);
+                                if(!pstate)
                                     return false;
 
                                 /* Check for overflows. */
-                                uint32_t nSize = 4096 + state.GetState().size();
+                                uint32_t nSize = 4096 + pstate->GetState().size();
                                 if(nCost + nSize < nCost)
                                     throw debug::exception("OP::REGISTER::STATE costs value overflow");
 
@@ -1374,21 +1348,11 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::STATE:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
-                                /* Get the pre-state. */
-                                caller >>= state;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                /* Get the pre-state, only deserialized the first time it is used. */
+                                pstate = &read_prestate();
 
                                 /* Check for overflows. */
-                                uint32_t nSize = state.GetState().size();
+                                uint32_t nSize = pstate->GetState().size();
                                 if(nCost + nSize < nCost)
                                     throw debug::exception("OP::CALLER::PRESTATE::STATE costs value overflow");
 
@@ -1400,7 +1364,7 @@ namespace TAO
                         }
 
                         /* Allocate to the registers. */
-                        allocate(state.GetState(), vRet);
+                        allocate(pstate->GetState(), vRet);
 
                         break;
                     }
@@ -1411,7 +1375,7 @@ namespace TAO
                     case OP::REGISTER::VALUE:
                     {
                         /* Register state object. */
-                        TAO::Register::Object object;
+                        TAO::Register::Object* pobject = nullptr;
 
                         /* Check for register enum. */
                         switch(OPERATION)
@@ -1422,8 +1386,9 @@ namespace TAO
                                 uint256_t hashRegister;
                                 deallocate(hashRegister, vRet);
 
-                                /* Read the register states. */
-                                if(!LLD::Register->ReadState(hashRegister, object))
+                                /* Read the register states, only from disk the first time they are used. */
+                                pobject = read_register(hashRegister);
+                                if(!pobject)
                                     return false;
 
                                 /* Check for overflows. */
@@ -1438,18 +1403,8 @@ namespace TAO
 
                             case OP::CALLER::PRESTATE::VALUE:
                             {
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
-
-                                /* Read the pre-state state. */
-                                uint8_t nState = 0;
-                                caller >>= nState;
-
-                                /* Get the pre-state. */
-                                caller >>= object;
-
-                                /* Reset the contract. */
-                                caller.Reset(Contract::REGISTERS);
+                                /* Get the pre-state, only deserialized the first time it is used. */
+                                pobject = &read_prestate();
 
                                 break;
                             }
@@ -1460,16 +1415,16 @@ namespace TAO
                         contract >= strValue;
 
                         /* Check for object register type. */
-                        if(object.nType != TAO::Register::REGISTER::OBJECT)
+                        if(pobject->nType != TAO::Register::REGISTER::OBJECT)
                             return false;
 
                         /* Parse the object register. */
-                        if(!object.Parse())
+                        if(!pobject->pLayout && !pobject->Parse())
                             return false;
 
                         /* Get the supported type enumeration. */
                         uint8_t nType;
-                        if(!object.Type(strValue, nType))
+                        if(!pobject->Type(strValue, nType))
                             return false;
 
                         /* Switch supported types. */
@@ -1480,7 +1435,7 @@ namespace TAO
                             {
                                 /* Read the value. */
                                 uint8_t nValue;
-                                if(!object.Read(strValue, nValue))
+                                if(!pobject->Read(strValue, nValue))
                                     return false;
 
                                 /* Allocate the value. */
@@ -1502,7 +1457,7 @@ namespace TAO
                             {
                                 /* Read the value. */
                                 uint16_t nValue;
-                                if(!object.Read(strValue, nValue))
+                                if(!pobject->Read(strValue, nValue))
                                     return false;
 
                                 /* Allocate the value. */
@@ -1524,7 +1479,7 @@ namespace TAO
                             {
                                 /* Read the value. */
                                 uint32_t nValue;
-                                if(!object.Read(strValue, nValue))
+                                if(!pobject->Read(strValue, nValue))
                                     return false;
 
                                 /* Allocate the value. */
@@ -1546,7 +1501,7 @@ namespace TAO
                             {
                                 /* Read the value. */
                                 uint64_t nValue;
-                                if(!object.Read(strValue, nValue))
+                                if(!pobject->Read(strValue, nValue))
                                     return false;
 
                                 /* Allocate the value. */
@@ -1568,7 +1523,7 @@ namespace TAO
                             {
                                 /* Read the value. */
                                 uint256_t nValue;
-                                if(!object.Read(strValue, nValue))
+                                if(!pobject->Read(strValue, nValue))
                                     return false;
 
                                 /* Allocate the value. */
@@ -1590,7 +1545,7 @@ namespace TAO
                             {
                                 /* Read the value. */
                                 uint512_t nValue;
-                                if(!object.Read(strValue, nValue))
+                                if(!pobject->Read(strValue, nValue))
                                     return false;
 
                                 /* Allocate the value. */
@@ -1612,7 +1567,7 @@ namespace TAO
                             {
                                 /* Read the value. */
                                 uint1024_t nValue;
-                                if(!object.Read(strValue, nValue))
+                                if(!pobject->Read(strValue, nValue))
                                     return false;
 
                                 /* Allocate the value. */
@@ -1634,7 +1589,7 @@ namespace TAO
                             {
                                 /* Read the value. */
                                 std::string strData;
-                                if(!object.Read(strValue, strData))
+                                if(!pobject->Read(strValue, strData))
                                     return false;
 
                                 /* Allocate the value. */
@@ -1657,7 +1612,7 @@ namespace TAO
                             {
                                 /* Read the value. */
                                 std::vector<uint8_t> vData;
-                                if(!object.Read(strValue, vData))
+                                if(!pobject->Read(strValue, vData))
                                     return false;
 
                                 /* Allocate the value. */
@@ -1971,5 +1926,47 @@ namespace TAO
 
             return true;
         }
+
+
+        /* Get a register's state from disk, only reading it the first time it is used by this condition. */
+        TAO::Register::Object* Condition::read_register(const uint256_t& hashRegister)
+        {
+            /* Check for a state we have already read. */
+            auto it = mapRegisters.find(hashRegister);
+            if(it != mapRegisters.end())
+                return &it->second;
+
+            /* Read the register states. */
+            TAO::Register::Object state;
+            if(!LLD::Register->ReadState(hashRegister, state))
+                return nullptr;
+
+            return &mapRegisters.emplace(hashRegister, std::move(state)).first->second;
+        }
+
+
+        /* Get the caller's pre-state, only deserializing it the first time it is used by this condition. */
+        TAO::Register::Object& Condition::read_prestate()
+        {
+            /* Check for a pre-state we have already read. */
+            if(fPrestate)
+                return statePrestate;
+
+            /* Reset the contract. */
+            caller.Reset(Contract::REGISTERS);
+
+            /* Read the pre-state state. */
+            uint8_t nState = 0;
+            caller >>= nState;
+
+            /* Get the pre-state. */
+            caller >>= statePrestate;
+
+            /* Reset the contract. */
+            caller.Reset(Contract::REGISTERS);
+
+            fPrestate = true;
+            return statePrestate;
+        }
     }
 }
@@ -116,6 +116,16 @@ namespace TAO
             nVersion   = tx->nVersion;
         }
 
+
+        /* Bind the contract to a transaction whose txid is already known. */
+        void Contract::Bind(const uint256_t& hashCallerIn, const uint64_t nTimestampIn, const uint512_t& hashTxIn, const uint32_t nVersionIn) const
+        {
+            hashCaller = hashCallerIn;
+            nTimestamp = nTimestampIn;
+            hashTx     = hashTxIn;
+            nVersion   = nVersionIn;
+        }
+
         /* Get the primitive operation. */
         uint8_t Contract::Primitive() const
         {
@@ -107,7 +107,7 @@ namespace TAO
                 return debug::error(FUNCTION, "cannot credit to a non-account base object");
 
             /* Write the new balance to object register. */
-            if(!account.Write("balance", account.get<uint64_t>("balance") + nAmount))
+            if(!account.Write(TAO::Register::FIELDS::BALANCE, account.get<uint64_t>(TAO::Register::FIELDS::BALANCE) + nAmount))
                 return debug::error(FUNCTION, "balance could not be written to object register");
 
             /* Update the state register's timestamp. */
@@ -236,7 +236,7 @@ namespace TAO
                     return debug::error(FUNCTION, "credit and coinbase mismatch");
 
                 /* Check the identifier. */
-                if(account.get<uint256_t>("token") != 0)
+                if(account.get<uint256_t>(TAO::Register::FIELDS::TOKEN) != 0)
                     return debug::error(FUNCTION, "credit disabled for coinbase of non-native token");
 
                 /* Seek read position to first position. */
@@ -319,7 +319,7 @@ namespace TAO
                 return debug::error(FUNCTION, "debit from must have a base account object");
 
             /* Check token identifiers. */
-            if(accountFrom.get<uint256_t>("token") != account.get<uint256_t>("token"))
+            if(accountFrom.get<uint256_t>(TAO::Register::FIELDS::TOKEN) != account.get<uint256_t>(TAO::Register::FIELDS::TOKEN))
                 return debug::error(FUNCTION, "credit can't be of different identifier");
 
             /* Handle one-to-one debit to credit or return to self. */
@@ -414,7 +414,7 @@ namespace TAO
                 return debug::error(FUNCTION, "owner object is not a token");
 
             /* Check that the token indetifier matches token identifier. */
-            if(proof.get<uint256_t>("token") != token.get<uint256_t>("token"))
+            if(proof.get<uint256_t>(TAO::Register::FIELDS::TOKEN) != token.get<uint256_t>(TAO::Register::FIELDS::TOKEN))
                 return debug::error(FUNCTION, "account proof identifier not token identifier");
 
             /* Get the total amount of the debit. */
@@ -422,7 +422,7 @@ namespace TAO
             debit >> nDebit;
 
             /* Get the total tokens to be distributed. */
-            uint64_t nPartial = (proof.get<uint64_t>("balance") * nDebit) / token.get<uint64_t>("supply");
+            uint64_t nPartial = (proof.get<uint64_t>(TAO::Register::FIELDS::BALANCE) * nDebit) / token.get<uint64_t>(TAO::Register::FIELDS::SUPPLY);
 
             /* Check that the partial amount matches. */
             if(nCredit != nPartial)
@@ -70,11 +70,11 @@ namespace TAO
                 return debug::error(FUNCTION, "cannot debit from non-standard object register");
 
             /* Check the account balance. */
-            if(nAmount > account.get<uint64_t>("balance"))
+            if(nAmount > account.get<uint64_t>(TAO::Register::FIELDS::BALANCE))
                 return debug::error(FUNCTION, "account doesn't have sufficient balance");
 
             /* Write the new balance to object register. */
-            if(!account.Write("balance", account.get<uint64_t>("balance") - nAmount))
+            if(!account.Write(TAO::Register::FIELDS::BALANCE, account.get<uint64_t>(TAO::Register::FIELDS::BALANCE) - nAmount))
                 return debug::error(FUNCTION, "balance could not be written to object register");
 
             /* Update the register's checksum. */
@@ -50,15 +50,15 @@ namespace TAO
                 return debug::error(FUNCTION, "cannot debit from non-standard object register");
 
             /* Check that type is native token. */
-            if(account.get<uint256_t>("token") != 0)
+            if(account.get<uint256_t>(TAO::Register::FIELDS::TOKEN) != 0)
                 return debug::error(FUNCTION, "cannot pay fees with non-native token");
 
             /* Check the account balance. */
-            if(nFees > account.get<uint64_t>("balance"))
-                return debug::error(FUNCTION, "account doesn't have sufficient balance ", account.get<uint64_t>("balance"));
+            if(nFees > account.get<uint64_t>(TAO::Register::FIELDS::BALANCE))
+                return debug::error(FUNCTION, "account doesn't have sufficient balance ", account.get<uint64_t>(TAO::Register::FIELDS::BALANCE));
 
             /* Write the new balance to object register. */
-            if(!account.Write("balance", account.get<uint64_t>("balance") - nFees))
+            if(!account.Write(TAO::Register::FIELDS::BALANCE, account.get<uint64_t>(TAO::Register::FIELDS::BALANCE) - nFees))
                 return debug::error(FUNCTION, "balance could not be written to object register");
 
             /* Update the register's checksum. */
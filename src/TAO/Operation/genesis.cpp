@@ -71,24 +71,24 @@ namespace TAO
                 return debug::error(FUNCTION, "no genesis for non-trust account");
 
             /* Check that there is no stake. */
-            if(trust.get<uint64_t>("stake") != 0)
+            if(trust.get<uint64_t>(TAO::Register::FIELDS::STAKE) != 0)
                 return debug::error(FUNCTION, "cannot create genesis with already existing stake");
 
             /* Check that there is no trust. */
-            if(trust.get<uint64_t>("trust") !=
+            if(trust.get<uint64_t>(TAO::Register::FIELDS::TRUST) !=
             ((config::fTestNet.load() && config::GetBoolArg("-trustboost")) ? TAO::Ledger::ONE_YEAR : 0))
                 return debug::error(FUNCTION, "cannot create genesis with already existing trust");
 
             /* Check available balance to stake. */
-            if(trust.get<uint64_t>("balance") == 0)
+            if(trust.get<uint64_t>(TAO::Register::FIELDS::BALANCE) == 0)
                 return debug::error(FUNCTION, "cannot create genesis with no available balance");
 
             /* Move existing balance to stake. */
-            if(!trust.Write("stake", trust.get<uint64_t>("balance")))
+            if(!trust.Write(TAO::Register::FIELDS::STAKE, trust.get<uint64_t>(TAO::Register::FIELDS::BALANCE)))
                 return debug::error(FUNCTION, "stake could not be written to object register");
 
             /* Write the stake reward to balance in object register. */
-            if(!trust.Write("balance", nReward))
+            if(!trust.Write(TAO::Register::FIELDS::BALANCE, nReward))
                 return debug::error(FUNCTION, "balance could not be written to object register");
 
             /* Update the state register's timestamp. */
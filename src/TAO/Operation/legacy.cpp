@@ -51,15 +51,15 @@ namespace TAO
                 return debug::error(FUNCTION, "cannot debit from non-standard object register");
 
             /* Check that type is native token. */
-            if(account.get<uint256_t>("token") != 0)
+            if(account.get<uint256_t>(TAO::Register::FIELDS::TOKEN) != 0)
                 return debug::error(FUNCTION, "cannot transfer to UTXO with non-native token");
 
             /* Check the account balance. */
-            if(nAmount > account.get<uint64_t>("balance"))
+            if(nAmount > account.get<uint64_t>(TAO::Register::FIELDS::BALANCE))
                 return debug::error(FUNCTION, "account doesn't have sufficient balance");
 
             /* Write the new balance to object register. */
-            if(!account.Write("balance", account.get<uint64_t>("balance") - nAmount))
+            if(!account.Write(TAO::Register::FIELDS::BALANCE, account.get<uint64_t>(TAO::Register::FIELDS::BALANCE) - nAmount))
                 return debug::error(FUNCTION, "balance could not be written to object register");
 
             /* Update the register's checksum. */
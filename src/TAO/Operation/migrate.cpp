@@ -83,19 +83,19 @@ namespace TAO
                 return debug::error(FUNCTION, "cannot migrate to a non-trust account");
 
             /* Check that there is no stake. */
-            if(trust.get<uint64_t>("stake") != 0)
+            if(trust.get<uint64_t>(TAO::Register::FIELDS::STAKE) != 0)
                 return debug::error(FUNCTION, "cannot migrate with already existing stake");
 
             /* Check that there is no trust. */
-            if(trust.get<uint64_t>("trust") != 0)
+            if(trust.get<uint64_t>(TAO::Register::FIELDS::TRUST) != 0)
                 return debug::error(FUNCTION, "cannot migrate with already existing trust");
 
             /* Write the migrated stake to trust account register. */
-            if(!trust.Write("stake", nAmount))
+            if(!trust.Write(TAO::Register::FIELDS::STAKE, nAmount))
                 return debug::error(FUNCTION, "stake could not be written to object register");
 
             /* Write the migrated trust to trust account register. Also converts old trust score from uint32_t to uint64_t */
-            if(!trust.Write("trust", static_cast<uint64_t>(nScore)))
+            if(!trust.Write(TAO::Register::FIELDS::TRUST, static_cast<uint64_t>(nScore)))
                 return debug::error(FUNCTION, "trust could not be written to object register");
 
             /* Update the state register's timestamp. */
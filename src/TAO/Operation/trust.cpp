@@ -64,8 +64,8 @@ namespace TAO
                 return debug::error(FUNCTION, "no trust for non-trust account");
 
             /* Get account starting values */
-            uint64_t nStakePrev = trust.get<uint64_t>("stake");
-            uint64_t nBalancePrev = trust.get<uint64_t>("balance");
+            uint64_t nStakePrev = trust.get<uint64_t>(TAO::Register::FIELDS::STAKE);
+            uint64_t nBalancePrev = trust.get<uint64_t>(TAO::Register::FIELDS::BALANCE);
 
             uint64_t nStakeAdded = 0;
             uint64_t nStakeRemoved = 0;
@@ -87,15 +87,15 @@ namespace TAO
             }
 
             /* Write the new trust to object register. */
-            if(!trust.Write("trust", nScore))
+            if(!trust.Write(TAO::Register::FIELDS::TRUST, nScore))
                 return debug::error(FUNCTION, "trust could not be written to object register");
 
             /* Write the new balance to object register. */
-            if(!trust.Write("balance", nBalancePrev + nReward + nStakeRemoved - nStakeAdded))
+            if(!trust.Write(TAO::Register::FIELDS::BALANCE, nBalancePrev + nReward + nStakeRemoved - nStakeAdded))
                 return debug::error(FUNCTION, "balance could not be written to object register");
 
             /* Write the new stake to object register. */
-            if(!trust.Write("stake", nStakePrev + nStakeAdded - nStakeRemoved))
+            if(!trust.Write(TAO::Register::FIELDS::STAKE, nStakePrev + nStakeAdded - nStakeRemoved))
                 return debug::error(FUNCTION, "stake could not be written to object register");
 
             /* Update the state register's timestamp. */
@@ -18,10 +18,12 @@ ________________________________________________________________________________
 #include <TAO/Operation/types/stream.h>
 
 #include <TAO/Register/types/basevm.h>
+#include <TAO/Register/types/object.h>
 #include <TAO/Register/types/value.h>
 
 #include <TAO/Ledger/types/transaction.h>
 
+#include <map>
 #include <stack>
 
 namespace TAO
@@ -48,6 +50,18 @@ namespace TAO
             std::stack<std::pair<bool, uint8_t>> vEvaluate;
 
 
+            /** Register states read from disk by this condition, by address. **/
+            std::map<uint256_t, TAO::Register::Object> mapRegisters;
+
+
+            /** The caller's pre-state, once deserialized. **/
+            TAO::Register::Object statePrestate;
+
+
+            /** Flag to determine if the caller's pre-state has been deserialized. **/
+            bool fPrestate;
+
+
         public:
 
 
@@ -125,6 +139,27 @@ namespace TAO
             bool EvaluateV2();
 
 
+            /** read_register
+             *
+             *  Get a register's state from disk, only reading it the first time it is used by this condition.
+             *
+             *  @param[in] hashRegister The register address.
+             *
+             *  @return Pointer to the state, nullptr if it failed to read.
+             *
+             **/
+            TAO::Register::Object* read_register(const uint256_t& hashRegister);
+
+
+            /** read_prestate
+             *
+             *  Get the caller's pre-state, only deserializing it the first time it is used by this condition.
+             *
+             *  @return Reference to the pre-state.
+             *
+             **/
+            TAO::Register::Object& read_prestate();
+
 
         };
     }
@@ -130,6 +130,19 @@ namespace TAO
             void Bind(const TAO::Ledger::Transaction* tx, bool fBindTxid = true) const;
 
 
+            /** Bind
+             *
+             *  Bind the contract to a transaction whose txid is already known.
+             *
+             *  @param[in] hashCallerIn The genesis of the transaction.
+             *  @param[in] nTimestampIn The timestamp of the transaction.
+             *  @param[in] hashTxIn The txid of the transaction.
+             *  @param[in] nVersionIn The version of the transaction.
+             *
+             **/
+            void Bind(const uint256_t& hashCallerIn, const uint64_t nTimestampIn, const uint512_t& hashTxIn, const uint32_t nVersionIn) const;
+
+
             /** Primitive
              *
              *  Get the primitive operation.
@@ -15,6 +15,8 @@ ________________________________________________________________________________
 #ifndef NEXUS_TAO_REGISTER_INCLUDE_ENUM_H
 #define NEXUS_TAO_REGISTER_INCLUDE_ENUM_H
 
+#include <string>
+
 /* Global TAO namespace. */
 namespace TAO
 {
@@ -131,6 +133,31 @@ namespace TAO
         }
 
 
+        /** FIELDS
+         *
+         *  Identifiers for data members of standard object registers, for lookups without names.
+         *
+         **/
+        namespace FIELDS
+        {
+            enum
+            {
+                BALANCE     = 0x00,
+                TOKEN       = 0x01,
+                SUPPLY      = 0x02,
+                DECIMALS    = 0x03,
+                TRUST       = 0x04,
+                STAKE       = 0x05,
+                NAMESPACE   = 0x06,
+                NAME        = 0x07,
+                ADDRESS     = 0x08,
+
+                //total number of field identifiers
+                LIMIT       = 0x09
+            };
+        }
+
+
         /** STATES
          *
          *  The states for the register script in transaction.
@@ -0,0 +1,379 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "act the way you'd like to be and soon you'll be the way you act" - Leonard Cohen
+
+____________________________________________________________________________________________*/
+
+#include <TAO/Register/types/layout.h>
+
+#include <Util/include/mutex.h>
+
+#include <algorithm>
+#include <cstring>
+#include <mutex>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Register Layer namespace. */
+    namespace Register
+    {
+
+        /** The maximum number of distinct shapes to intern. **/
+        const uint32_t MAX_LAYOUTS = 4096;
+
+
+        /** The data member names for each standard field id. **/
+        const std::string FIELD_NAMES[FIELDS::LIMIT] =
+        {
+            "balance", "token", "supply", "decimals", "trust", "stake", "namespace", "name", "address"
+        };
+
+
+        /** Mutex to protect the interned layouts. **/
+        std::mutex LAYOUT_MUTEX;
+
+
+        /** The interned layouts keyed by binary shape. **/
+        std::unordered_map<std::string, std::shared_ptr<const Layout>> mapLayouts;
+
+
+        /** Template
+         *
+         *  The expected byte stream of a standard object with fixed size members, where only the
+         *  values are allowed to differ.
+         *
+         **/
+        struct Template
+        {
+            /** The total size of the object state. **/
+            uint32_t nSize;
+
+
+            /** The binary position and expected bytes of each member header. **/
+            std::vector< std::pair<uint32_t, std::vector<uint8_t>> > vHeaders;
+
+
+            /** The shared layout for this template. **/
+            std::shared_ptr<const Layout> pLayout;
+        };
+
+
+        /* Get the serialized size of a fixed size type, 0 for variable types. */
+        uint32_t fixed_size(const uint8_t nType)
+        {
+            switch(nType)
+            {
+                case TYPES::UINT8_T:
+                    return 1;
+
+                case TYPES::UINT16_T:
+                    return 2;
+
+                case TYPES::UINT32_T:
+                    return 4;
+
+                case TYPES::UINT64_T:
+                    return 8;
+
+                case TYPES::UINT256_T:
+                    return 32;
+
+                case TYPES::UINT512_T:
+                    return 64;
+
+                case TYPES::UINT1024_T:
+                    return 128;
+            }
+
+            return 0;
+        }
+
+
+        /* Build a template from a list of fixed size members in serialization order. */
+        Template make_template(const std::vector<Layout::Field>& vMembers)
+        {
+            Template tmpl;
+            tmpl.nSize = 0;
+
+            /* Build the headers exactly as the object would be serialized. */
+            std::string strKey;
+            std::vector<Layout::Field> vFields;
+            for(const auto& member : vMembers)
+            {
+                std::vector<uint8_t> vHeader;
+                vHeader.push_back(static_cast<uint8_t>(member.strName.size()));
+                vHeader.insert(vHeader.end(), member.strName.begin(), member.strName.end());
+
+                /* Add the mutable specifier. */
+                if(member.fMutable)
+                    vHeader.push_back(static_cast<uint8_t>(TYPES::MUTABLE));
+
+                vHeader.push_back(member.nType);
+
+                /* Track the binary position of type. */
+                Layout::Field field = member;
+                field.nPosition = static_cast<uint16_t>(tmpl.nSize + vHeader.size() - 1);
+                vFields.push_back(field);
+
+                /* Add to our shape key. */
+                strKey.append(vHeader.begin(), vHeader.end());
+
+                tmpl.vHeaders.push_back(std::make_pair(tmpl.nSize, vHeader));
+                tmpl.nSize += static_cast<uint32_t>(vHeader.size()) + fixed_size(member.nType);
+            }
+
+            tmpl.pLayout = Layout::Intern(strKey, std::move(vFields));
+
+            return tmpl;
+        }
+
+
+        /* Constructor */
+        Layout::Layout(std::vector<Field>&& vFieldsIn)
+        : vFields   (std::move(vFieldsIn))
+        , mapIndex  ( )
+        , nIndex    ( )
+        , nStandard (OBJECTS::NONSTANDARD)
+        , nBase     (OBJECTS::NONSTANDARD)
+        {
+            /* Index our members by name. */
+            for(uint16_t n = 0; n < vFields.size(); ++n)
+                mapIndex.emplace(vFields[n].strName, n);
+
+            /* Index our members by standard field id. */
+            for(uint8_t n = 0; n < FIELDS::LIMIT; ++n)
+            {
+                auto it = mapIndex.find(FIELD_NAMES[n]);
+                nIndex[n] = (it == mapIndex.end()) ? -1 : static_cast<int16_t>(it->second);
+            }
+
+            /* Search object register for key types. */
+            if(vFields.size() == 1
+            && check("namespace", TYPES::STRING, false))
+            {
+                /* If it only contains one field called namespace then it must be a namespace */
+                nStandard = OBJECTS::NAMESPACE;
+            }
+            else if(vFields.size() == 9
+            && check("auth", TYPES::UINT256_T, true)
+            && check("lisp", TYPES::UINT256_T, true)
+            && check("network", TYPES::UINT256_T, true)
+            && check("sign", TYPES::UINT256_T, true)
+            && check("verify", TYPES::UINT256_T, true)
+            && check("cert", TYPES::UINT256_T, true)
+            && check("app1", TYPES::UINT256_T, true)
+            && check("app2", TYPES::UINT256_T, true)
+            && check("app3", TYPES::UINT256_T, true))
+            {
+                nStandard = OBJECTS::CRYPTO;
+            }
+            else if(vFields.size() == 3
+            && check("namespace", TYPES::STRING, false)
+            && check("name", TYPES::STRING, false)
+            && Find(uint8_t(FIELDS::ADDRESS))) /* Name registers can store different types in the address so don't check the field type */
+            {
+                nStandard = OBJECTS::NAME;
+            }
+            else if(check("token", TYPES::UINT256_T, false)
+            && check("balance",    TYPES::UINT64_T,  true))
+            {
+                nStandard = OBJECTS::ACCOUNT;
+
+                /* Make the supply immutable for now (add continued distribution later). */
+                if(check("supply", TYPES::UINT64_T, false)
+                && check("decimals", TYPES::UINT8_T, false))
+                    nStandard = OBJECTS::TOKEN;
+
+                else if(check("trust", TYPES::UINT64_T, true)
+                     && check("stake", TYPES::UINT64_T, true))
+                    nStandard = OBJECTS::TRUST;
+            }
+
+            /* Search object register for base types. */
+            if(check("token",   TYPES::UINT256_T, false)
+            && check("balance", TYPES::UINT64_T,  true))
+                nBase = OBJECTS::ACCOUNT;
+
+            else if(check("namespace", TYPES::STRING, false))
+                nBase = OBJECTS::NAMESPACE;
+        }
+
+
+        /* Find the layout of a standard object without parsing. */
+        std::shared_ptr<const Layout> Layout::Match(const std::vector<uint8_t>& vchState)
+        {
+            /* The standard objects with only fixed size members, in the order they are created. */
+            static const std::vector<Template> vTemplates =
+            {
+                /* Account object register. */
+                make_template(
+                {
+                    {"balance",  0, TYPES::UINT64_T,  true},
+                    {"token",    0, TYPES::UINT256_T, false}
+                }),
+
+                /* Trust object register. */
+                make_template(
+                {
+                    {"balance",  0, TYPES::UINT64_T,  true},
+                    {"trust",    0, TYPES::UINT64_T,  true},
+                    {"stake",    0, TYPES::UINT64_T,  true},
+                    {"token",    0, TYPES::UINT256_T, false}
+                }),
+
+                /* Token object register. */
+                make_template(
+                {
+                    {"balance",  0, TYPES::UINT64_T,  true},
+                    {"token",    0, TYPES::UINT256_T, false},
+                    {"supply",   0, TYPES::UINT64_T,  false},
+                    {"decimals", 0, TYPES::UINT8_T,   false}
+                }),
+
+                /* Crypto object register. */
+                make_template(
+                {
+                    {"auth",     0, TYPES::UINT256_T, true},
+                    {"lisp",     0, TYPES::UINT256_T, true},
+                    {"network",  0, TYPES::UINT256_T, true},
+                    {"sign",     0, TYPES::UINT256_T, true},
+                    {"verify",   0, TYPES::UINT256_T, true},
+                    {"cert",     0, TYPES::UINT256_T, true},
+                    {"app1",     0, TYPES::UINT256_T, true},
+                    {"app2",     0, TYPES::UINT256_T, true},
+                    {"app3",     0, TYPES::UINT256_T, true}
+                })
+            };
+
+            /* Check each template against the state. */
+            for(const auto& tmpl : vTemplates)
+            {
+                /* Fixed size members means the total size must match. */
+                if(vchState.size() != tmpl.nSize)
+                    continue;
+
+                /* Check the member headers, skipping the values. */
+                bool fMatch = true;
+                for(const auto& header : tmpl.vHeaders)
+                {
+                    if(std::memcmp(&vchState[header.first], &header.second[0], header.second.size()) != 0)
+                    {
+                        fMatch = false;
+                        break;
+                    }
+                }
+
+                if(fMatch)
+                    return tmpl.pLayout;
+            }
+
+            return nullptr;
+        }
+
+
+        /* Get the shared layout for a given shape, creating it if it hasn't been seen. */
+        std::shared_ptr<const Layout> Layout::Intern(const std::string& strKey, std::vector<Field>&& vFieldsIn)
+        {
+            {
+                LOCK(LAYOUT_MUTEX);
+
+                /* Check for an existing layout. */
+                auto it = mapLayouts.find(strKey);
+                if(it != mapLayouts.end())
+                    return it->second;
+            }
+
+            /* Sort our members by name. */
+            std::sort(vFieldsIn.begin(), vFieldsIn.end(),
+                [](const Field& a, const Field& b)
+                {
+                    return a.strName < b.strName;
+                });
+
+            /* Disallow duplicate value entries. */
+            for(uint32_t n = 1; n < vFieldsIn.size(); ++n)
+                if(vFieldsIn[n - 1].strName == vFieldsIn[n].strName)
+                    return nullptr;
+
+            /* Build our new layout outside of the lock. */
+            std::shared_ptr<const Layout> pLayout = std::shared_ptr<const Layout>(new Layout(std::move(vFieldsIn)));
+
+            LOCK(LAYOUT_MUTEX);
+
+            /* Don't grow without bound on arbitrary user objects. */
+            if(mapLayouts.size() >= MAX_LAYOUTS)
+                return pLayout;
+
+            return mapLayouts.emplace(strKey, pLayout).first->second;
+        }
+
+
+        /* Find a data member by name. */
+        const Layout::Field* Layout::Find(const std::string& strName) const
+        {
+            auto it = mapIndex.find(strName);
+            if(it == mapIndex.end())
+                return nullptr;
+
+            return &vFields[it->second];
+        }
+
+
+        /* Find a data member by its standard field id. */
+        const Layout::Field* Layout::Find(const uint8_t nField) const
+        {
+            if(nField >= FIELDS::LIMIT || nIndex[nField] < 0)
+                return nullptr;
+
+            return &vFields[nIndex[nField]];
+        }
+
+
+        /* Get the data members sorted by name. */
+        const std::vector<Layout::Field>& Layout::Fields() const
+        {
+            return vFields;
+        }
+
+
+        /* Get the total number of data members. */
+        uint32_t Layout::Size() const
+        {
+            return static_cast<uint32_t>(vFields.size());
+        }
+
+
+        /* Gets the standard object type. */
+        uint8_t Layout::Standard() const
+        {
+            return nStandard;
+        }
+
+
+        /* Gets the standard object base type. */
+        uint8_t Layout::Base() const
+        {
+            return nBase;
+        }
+
+
+        /* Check a data member exists with given type and mutability. */
+        bool Layout::check(const std::string& strName, const uint8_t nType, const bool fMutable) const
+        {
+            const Field* pField = Find(strName);
+            if(!pField)
+                return false;
+
+            return (pField->nType == nType && pField->fMutable == fMutable);
+        }
+    }
+}
@@ -0,0 +1,166 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/Register/types/metrics.h>
+#include <TAO/Register/types/object.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Register Layer namespace. */
+    namespace Register
+    {
+
+        /* Default Constructor. */
+        Metrics::Metrics()
+        : nAccounts        (0)
+        , nAppend          (0)
+        , nCrypto          (0)
+        , nNames           (0)
+        , nGlobalNames     (0)
+        , nNamespacedNames (0)
+        , nNamespaces      (0)
+        , nObjects         (0)
+        , nTokenized       (0)
+        , nRaw             (0)
+        , nReadOnly        (0)
+        , nTokens          (0)
+        , nTrustKeys       (0)
+        , nStake           (0)
+        , nTrust           (0)
+        {
+        }
+
+
+        /* Add a register state to the aggregates. */
+        void Metrics::Add(const uint8_t nAddress, const State& state)
+        {
+            update(nAddress, state, 1);
+        }
+
+
+        /* Remove a register state from the aggregates. */
+        void Metrics::Remove(const uint8_t nAddress, const State& state)
+        {
+            update(nAddress, state, -1);
+        }
+
+
+        /* Get the total registers counted by the metrics API. */
+        uint64_t Metrics::Registers() const
+        {
+            return nTrustKeys + nNames + nNamespaces + nAccounts + nCrypto
+                 + nTokens + nAppend + nRaw + nReadOnly + nObjects;
+        }
+
+
+        /* Apply the contribution of a register state with given sign. */
+        void Metrics::update(const uint8_t nAddress, const State& state, const int64_t nDelta)
+        {
+            /* Unsigned wrap-around keeps removals exact, since every removal follows its add. */
+            const uint64_t nSign = static_cast<uint64_t>(nDelta);
+
+            /* Switch based on the address type, which is how registers are keyed on disk. */
+            switch(nAddress)
+            {
+                case Address::ACCOUNT:
+                    nAccounts += nSign;
+                    break;
+
+                case Address::APPEND:
+                    nAppend += nSign;
+                    break;
+
+                case Address::CRYPTO:
+                    nCrypto += nSign;
+                    break;
+
+                case Address::NAMESPACE:
+                    nNamespaces += nSign;
+                    break;
+
+                case Address::RAW:
+                    nRaw += nSign;
+                    break;
+
+                case Address::READONLY:
+                    nReadOnly += nSign;
+                    break;
+
+                case Address::TOKEN:
+                    nTokens += nSign;
+                    break;
+
+                /* Trust accounts only count when they have stake. */
+                case Address::TRUST:
+                {
+                    Object object = Object(state);
+                    if(!object.Parse())
+                        break;
+
+                    /* Check stake value over 0. */
+                    uint64_t nAmount = 0;
+                    if(!object.Read(FIELDS::STAKE, nAmount) || nAmount == 0)
+                        break;
+
+                    uint64_t nScore = 0;
+                    object.Read(FIELDS::TRUST, nScore);
+
+                    nTrustKeys += nSign;
+                    nStake     += nSign * nAmount;
+                    nTrust     += nSign * nScore;
+
+                    break;
+                }
+
+                /* Names are split by their namespace. */
+                case Address::NAME:
+                {
+                    Object object = Object(state);
+                    if(!object.Parse())
+                        break;
+
+                    std::string strNamespace;
+                    if(object.Read(FIELDS::NAMESPACE, strNamespace))
+                    {
+                        if(strNamespace == NAMESPACE::GLOBAL)
+                            nGlobalNames += nSign;
+                        else if(strNamespace != "")
+                            nNamespacedNames += nSign;
+                    }
+
+                    nNames += nSign;
+
+                    break;
+                }
+
+                /* Objects are split by whether they are tokenized. */
+                case Address::OBJECT:
+                {
+                    Object object = Object(state);
+                    if(!object.Parse())
+                        break;
+
+                    /* Check if tokenized. */
+                    if(Address(object.hashOwner).IsToken())
+                        nTokenized += nSign;
+
+                    nObjects += nSign;
+
+                    break;
+                }
+            }
+        }
+    }
+}
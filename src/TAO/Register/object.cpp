@@ -30,7 +30,7 @@ namespace TAO
         Object::Object()
         : State     (uint8_t(REGISTER::OBJECT))
         , vchSystem (512, 0) //system memory by default is 512 bytes
-        , mapData   ()
+        , pLayout   ()
         {
         }
 
@@ -39,7 +39,7 @@ namespace TAO
         Object::Object(const Object& object)
         : State     (object)
         , vchSystem (object.vchSystem)
-        , mapData   (object.mapData)
+        , pLayout   (object.pLayout)
         {
         }
 
@@ -48,7 +48,7 @@ namespace TAO
         Object::Object(Object&& object) noexcept
         : State     (std::move(object))
         , vchSystem (std::move(object.vchSystem))
-        , mapData   (std::move(object.mapData))
+        , pLayout   (std::move(object.pLayout))
         {
         }
 
@@ -66,7 +66,7 @@ namespace TAO
             hashChecksum = object.hashChecksum;
 
             nReadPos     = 0; //don't copy over read position
-            mapData      = object.mapData;
+            pLayout      = object.pLayout;
 
             return *this;
         }
@@ -85,7 +85,7 @@ namespace TAO
             hashChecksum = std::move(object.hashChecksum);
 
             nReadPos     = 0; //don't copy over read position
-            mapData      = std::move(object.mapData);
+            pLayout      = std::move(object.pLayout);
 
             return *this;
         }
@@ -101,7 +101,7 @@ namespace TAO
         Object::Object(const State& state)
         : State     (state)
         , vchSystem ()
-        , mapData   ()
+        , pLayout   ()
         {
         }
 
@@ -109,94 +109,36 @@ namespace TAO
         /* Get's the standard object type. */
         uint8_t Object::Standard() const
         {
-            /* Set the return value. */
-            uint8_t nType = OBJECTS::NONSTANDARD;
-
-            /* Search object register for key types. */
-            if(mapData.size() == 1
-            && Check("namespace", TYPES::STRING, false))
-            {
-                /* If it only contains one field called namespace then it must be a namespace */
-                /* Set the return value. */
-                nType = OBJECTS::NAMESPACE;
-
-            }
-            else if(mapData.size() == 9
-            && Check("auth", TYPES::UINT256_T, true)
-            && Check("lisp", TYPES::UINT256_T, true)
-            && Check("network", TYPES::UINT256_T, true)
-            && Check("sign", TYPES::UINT256_T, true)
-            && Check("verify", TYPES::UINT256_T, true)
-            && Check("cert", TYPES::UINT256_T, true)
-            && Check("app1", TYPES::UINT256_T, true)
-            && Check("app2", TYPES::UINT256_T, true)
-            && Check("app3", TYPES::UINT256_T, true))
-            {
-                /* Set the return value. */
-                nType = OBJECTS::CRYPTO;
-            }
-            else if(mapData.size() == 3
-            && Check("namespace", TYPES::STRING, false)
-            && Check("name", TYPES::STRING, false)
-            && CheckName("address")) /* Name registers can store different types in the address so don't check the field type */
-            {
-                /* Set the return value. */
-                nType = OBJECTS::NAME;
-
-            }
-            else if(Check("token", TYPES::UINT256_T, false)
-            && Check("balance",    TYPES::UINT64_T,  true))
+            /* Check the layout for empty. */
+            if(!pLayout)
             {
-                /* Set the return value. */
-                nType = OBJECTS::ACCOUNT;
-
-                /* Make the supply immutable for now (add continued distribution later). */
-                if(Check("supply", TYPES::UINT64_T, false)
-                && Check("decimals", TYPES::UINT8_T, false))
-                {
-                    /* Set the return value. */
-                    nType = OBJECTS::TOKEN;
-                }
-                else if(Check("trust", TYPES::UINT64_T, true)
-                     && Check("stake", TYPES::UINT64_T, true))
-                {
-                    /* Set the return value. */
-                    nType = OBJECTS::TRUST;
-                }
+                debug::error(FUNCTION, "object is not parsed");
+                return OBJECTS::NONSTANDARD;
             }
 
-            return nType;
+            return pLayout->Standard();
         }
 
 
         /* Get's the standard object base type. */
         uint8_t Object::Base() const
         {
-            /* Set the return value. */
-            uint8_t nType = OBJECTS::NONSTANDARD;
-
-            /* Search object register for key types. */
-            if(Check("token",   TYPES::UINT256_T, false)
-            && Check("balance", TYPES::UINT64_T,  true))
+            /* Check the layout for empty. */
+            if(!pLayout)
             {
-                /* Set the return value. */
-                nType = OBJECTS::ACCOUNT;
-            }
-            else if(Check("namespace", TYPES::STRING, false))
-            {
-                /* Set the return value. */
-                nType = OBJECTS::NAMESPACE;
+                debug::error(FUNCTION, "object is not parsed");
+                return OBJECTS::NONSTANDARD;
             }
 
-            return nType;
+            return pLayout->Base();
         }
 
 
         /* Get the cost to create this object register.*/
         uint64_t Object::Cost() const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 throw debug::exception(FUNCTION, "cannot get cost when object isn't parsed");
 
             /* Switch based on standard types. */
@@ -264,8 +206,8 @@ namespace TAO
         /* Parses out the data members of an object register. */
         bool Object::Parse()
         {
-            /* Check the map for empty. */
-            if(!mapData.empty())
+            /* Check the layout for empty. */
+            if(pLayout)
                 return debug::error(FUNCTION, "object is already parsed");
 
             /* Ensure that object register is of proper type. */
@@ -273,20 +215,28 @@ namespace TAO
             && this->nType != REGISTER::SYSTEM)
                 return false;
 
+            /* Standard objects with fixed size members don't need to be parsed. */
+            pLayout = Layout::Match(vchState);
+            if(pLayout)
+                return true;
+
             /* Reset the read position. */
             nReadPos   = 0;
 
+            /* The shape of this object, being every byte except fixed size values. */
+            std::string strKey;
+
             /* Read until end of state. */
+            std::vector<Layout::Field> vFields;
             while(!end())
             {
+                /* Track the start of this member. */
+                const uint64_t nStart = nReadPos;
+
                 /* Deserialize the named value. */
                 std::string name;
                 *this >> name;
 
-                /* Disallow duplicate value entries. */
-                if(mapData.count(name))
-                    return debug::error(FUNCTION, "duplicate value entries");
-
                 /* Deserialize the type. */
                 uint8_t nType;
                 *this >> nType;
@@ -304,6 +254,12 @@ namespace TAO
                     *this >> nType;
                 }
 
+                /* Track the binary position of type. */
+                Layout::Field field = { name, static_cast<uint16_t>(nReadPos - 1), nType, fMutable };
+
+                /* Add the member header to our shape. */
+                strKey.append((char*)&vchState[nStart], nReadPos - nStart);
+
                 /* Switch between supported types. */
                 switch(nType)
                 {
@@ -311,11 +267,8 @@ namespace TAO
                     /* Standard type for C++ uint8_t. */
                     case TYPES::UINT8_T:
                     {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 2;
+                        /* Iterate the types size. */
+                        nReadPos += 1;
 
                         break;
                     }
@@ -324,11 +277,8 @@ namespace TAO
                     /* Standard type for C++ uint16_t. */
                     case TYPES::UINT16_T:
                     {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 3;
+                        /* Iterate the types size. */
+                        nReadPos += 2;
 
                         break;
                     }
@@ -337,11 +287,8 @@ namespace TAO
                     /* Standard type for C++ uint32_t. */
                     case TYPES::UINT32_T:
                     {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 5;
+                        /* Iterate the types size. */
+                        nReadPos += 4;
 
                         break;
                     }
@@ -350,11 +297,8 @@ namespace TAO
                     /* Standard type for C++ uint64_t. */
                     case TYPES::UINT64_T:
                     {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 9;
+                        /* Iterate the types size. */
+                        nReadPos += 8;
 
                         break;
                     }
@@ -363,11 +307,8 @@ namespace TAO
                     /* Standard type for Custom uint256_t */
                     case TYPES::UINT256_T:
                     {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 33;
+                        /* Iterate the types size. */
+                        nReadPos += 32;
 
                         break;
                     }
@@ -376,11 +317,8 @@ namespace TAO
                     /* Standard type for Custom uint512_t */
                     case TYPES::UINT512_T:
                     {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 65;
+                        /* Iterate the types size. */
+                        nReadPos += 64;
 
                         break;
                     }
@@ -389,11 +327,8 @@ namespace TAO
                     /* Standard type for Custom uint1024_t */
                     case TYPES::UINT1024_T:
                     {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate the types size plus type byte. */
-                        nReadPos += 129;
+                        /* Iterate the types size. */
+                        nReadPos += 128;
 
                         break;
                     }
@@ -401,35 +336,17 @@ namespace TAO
 
                     /* Standard type for STL string */
                     case TYPES::STRING:
-                    {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate to start of size. */
-                        ++nReadPos;
-
-                        /* Find the serialized size of type. */
-                        uint64_t nSize = ReadCompactSize(*this);
-
-                        /* Iterate the type size */
-                        nReadPos += nSize;
-
-                        break;
-                    }
-
 
                     /* Standard type for STL vector with C++ type uint8_t */
                     case TYPES::BYTES:
                     {
-                        /* Track the binary position of type. */
-                        mapData.emplace(name, std::make_pair(--nReadPos, fMutable));
-
-                        /* Iterate to start of size. */
-                        ++nReadPos;
-
                         /* Find the serialized size of type. */
+                        const uint64_t nSizePos = nReadPos;
                         uint64_t nSize = ReadCompactSize(*this);
 
+                        /* Variable sizes shift later members, so they are part of our shape. */
+                        strKey.append((char*)&vchState[nSizePos], nReadPos - nSizePos);
+
                         /* Iterate the type size */
                         nReadPos += nSize;
 
@@ -441,8 +358,19 @@ namespace TAO
                     default:
                         return debug::error(FUNCTION, "malformed object register (unexpected type ", uint32_t(nType), ")");
                 }
+
+                vFields.push_back(std::move(field));
             }
 
+            /* An object without members is left unparsed. */
+            if(vFields.empty())
+                return true;
+
+            /* Get the shared layout for this shape. */
+            pLayout = Layout::Intern(strKey, std::move(vFields));
+            if(!pLayout)
+                return debug::error(FUNCTION, "duplicate value entries");
+
             return true;
         }
 
@@ -453,13 +381,16 @@ namespace TAO
             /* Declare the vector of field names to return */
             std::vector<std::string> vFieldNames;
 
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
+            {
                 debug::error(FUNCTION, "object is not parsed");
+                return vFieldNames;
+            }
 
-            /* Iterate data map and pull field names out into return vector */
-            for(const auto& fieldName : mapData)
-                vFieldNames.push_back(fieldName.first);
+            /* Iterate data members and pull field names out into return vector */
+            for(const auto& field : pLayout->Fields())
+                vFieldNames.push_back(field.strName);
 
             return vFieldNames;
         }
@@ -468,23 +399,20 @@ namespace TAO
         /* Get the type enumeration from the object register. */
         bool Object::Type(const std::string& strName, uint8_t& nType) const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            if(!mapData.count(strName))
+            const Layout::Field* pField = pLayout->Find(strName);
+            if(!pField)
                 return false;
 
             /* Find the binary position of value. */
-            nReadPos = mapData[strName].first;
+            nReadPos = pField->nPosition + 1;
 
-            /* Deserialize the type specifier. */
-            *this >> nType;
-
-            /* Check for unsupported type enums. */
-            if(nType == TYPES::UNSUPPORTED)
-                return debug::error(FUNCTION, "unsupported type");
+            /* Get the type specifier. */
+            nType = pField->nType;
 
             return true;
         }
@@ -493,46 +421,40 @@ namespace TAO
         /* Check the type enumeration from the object register. */
         bool Object::Check(const std::string& strName, const uint8_t nType, bool fMutable) const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            if(!mapData.count(strName))
+            const Layout::Field* pField = pLayout->Find(strName);
+            if(!pField)
                 return false;
 
-            /* Find the binary position of value. */
-            nReadPos = mapData[strName].first;
-
-            /* Deserialize the type specifier. */
-            uint8_t nCheck;
-            *this >> nCheck;
-
             /* Check for unsupported type enums. */
-            if(nType != nCheck)
+            if(nType != pField->nType)
                 return false;
 
-            return (fMutable == mapData[strName].second);
+            return (fMutable == pField->fMutable);
         }
 
 
         /* Check the name exists in the object register without checking type. */
         bool Object::CheckName(const std::string& strName) const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            return mapData.count(strName) > 0;
+            return pLayout->Find(strName) != nullptr;
         }
 
 
         /*  Get the size of value in object register. */
         uint64_t Object::Size(const std::string& strName) const
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Get the type for given name. */
@@ -588,24 +510,24 @@ namespace TAO
         /* Write into the object register a value of type bytes. */
         bool Object::Write(const std::string& strName, const std::string& strValue)
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            if(!mapData.count(strName))
+            const Layout::Field* pField = pLayout->Find(strName);
+            if(!pField)
                 return false;
 
             /* Check that the value is mutable (writes allowed). */
-            if(!mapData[strName].second)
+            if(!pField->fMutable)
                 return debug::error(FUNCTION, "cannot set value for READONLY data member");
 
             /* Find the binary position of value. */
-            nReadPos = mapData[strName].first;
+            nReadPos = pField->nPosition + 1;
 
-            /* Deserialize the type specifier. */
-            uint8_t nType;
-            *this >> nType;
+            /* Get the type specifier. */
+            const uint8_t nType = pField->nType;
 
             /* Make sure that value being written is type-safe. */
             if(nType != TYPES::STRING)
@@ -630,24 +552,24 @@ namespace TAO
         /* Write into the object register a value of type bytes. */
         bool Object::Write(const std::string& strName, const std::vector<uint8_t>& vData)
         {
-            /* Check the map for empty. */
-            if(mapData.empty())
+            /* Check the layout for empty. */
+            if(!pLayout)
                 return debug::error(FUNCTION, "object is not parsed");
 
             /* Check that the name exists in the object. */
-            if(!mapData.count(strName))
+            const Layout::Field* pField = pLayout->Find(strName);
+            if(!pField)
                 return false;
 
             /* Check that the value is mutable (writes allowed). */
-            if(!mapData[strName].second)
+            if(!pField->fMutable)
                 return debug::error(FUNCTION, "cannot set value for READONLY data member");
 
             /* Find the binary position of value. */
-            nReadPos = mapData[strName].first;
+            nReadPos = pField->nPosition + 1;
 
-            /* Deserialize the type specifier. */
-            uint8_t nType;
-            *this >> nType;
+            /* Get the type specifier. */
+            const uint8_t nType = pField->nType;
 
             /* Make sure that value being written is type-safe. */
             if(nType != TYPES::BYTES)
@@ -0,0 +1,196 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "act the way you'd like to be and soon you'll be the way you act" - Leonard Cohen
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_REGISTER_TYPES_LAYOUT_H
+#define NEXUS_TAO_REGISTER_TYPES_LAYOUT_H
+
+#include <TAO/Register/include/enum.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Register Layer namespace. */
+    namespace Register
+    {
+
+        /** Layout
+         *
+         *  Immutable description of the data members of an object register. Objects with the same
+         *  field names, types and variable sizes share a single interned layout, so parsing an
+         *  object only has to walk its byte stream the first time a shape is seen.
+         *
+         **/
+        class Layout
+        {
+        public:
+
+            /** Field
+             *
+             *  A single data member of an object register.
+             *
+             **/
+            struct Field
+            {
+                /** The name of the data member. **/
+                std::string strName;
+
+
+                /** The binary position of the type byte in the object state. **/
+                uint16_t nPosition;
+
+
+                /** The type enumeration of the data member. **/
+                uint8_t nType;
+
+
+                /** Flag to determine if writes are allowed. **/
+                bool fMutable;
+            };
+
+
+        private:
+
+            /** The data members sorted by name. **/
+            std::vector<Field> vFields;
+
+
+            /** Index of data members by name. **/
+            std::unordered_map<std::string, uint16_t> mapIndex;
+
+
+            /** Index of data members by standard field id, -1 if not present. **/
+            int16_t nIndex[FIELDS::LIMIT];
+
+
+            /** The standard object type. **/
+            uint8_t nStandard;
+
+
+            /** The standard object base type. **/
+            uint8_t nBase;
+
+
+            /** Constructor
+             *
+             *  @param[in] vFieldsIn The data members in any order.
+             *
+             **/
+            Layout(std::vector<Field>&& vFieldsIn);
+
+
+        public:
+
+            /** Match
+             *
+             *  Find the layout of a standard object by comparing its byte stream against the known
+             *  standard templates, without parsing.
+             *
+             *  @param[in] vchState The object register state.
+             *
+             *  @return the shared layout, or nullptr if the state is not a standard template.
+             *
+             **/
+            static std::shared_ptr<const Layout> Match(const std::vector<uint8_t>& vchState);
+
+
+            /** Intern
+             *
+             *  Get the shared layout for a given shape, creating it if it hasn't been seen.
+             *
+             *  @param[in] strKey The binary shape of the object, without any fixed size values.
+             *  @param[in] vFieldsIn The data members that were parsed for this shape.
+             *
+             *  @return the shared layout, or nullptr if the data members contain duplicates.
+             *
+             **/
+            static std::shared_ptr<const Layout> Intern(const std::string& strKey, std::vector<Field>&& vFieldsIn);
+
+
+            /** Find
+             *
+             *  Find a data member by name.
+             *
+             *  @param[in] strName The name of the data member.
+             *
+             *  @return pointer to the field, nullptr if not found.
+             *
+             **/
+            const Field* Find(const std::string& strName) const;
+
+
+            /** Find
+             *
+             *  Find a data member by its standard field id.
+             *
+             *  @param[in] nField The field id from FIELDS enumeration.
+             *
+             *  @return pointer to the field, nullptr if not found.
+             *
+             **/
+            const Field* Find(const uint8_t nField) const;
+
+
+            /** Fields
+             *
+             *  Get the data members sorted by name.
+             *
+             **/
+            const std::vector<Field>& Fields() const;
+
+
+            /** Size
+             *
+             *  Get the total number of data members.
+             *
+             **/
+            uint32_t Size() const;
+
+
+            /** Standard
+             *
+             *  Gets the standard object type.
+             *
+             **/
+            uint8_t Standard() const;
+
+
+            /** Base
+             *
+             *  Gets the standard object base type.
+             *
+             **/
+            uint8_t Base() const;
+
+
+        private:
+
+            /** check
+             *
+             *  Check a data member exists with given type and mutability.
+             *
+             **/
+            bool check(const std::string& strName, const uint8_t nType, const bool fMutable) const;
+
+        };
+    }
+}
+
+#endif
@@ -0,0 +1,174 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#pragma once
+#ifndef NEXUS_TAO_REGISTER_TYPES_METRICS_H
+#define NEXUS_TAO_REGISTER_TYPES_METRICS_H
+
+#include <Util/templates/serialize.h>
+
+/* Global TAO namespace. */
+namespace TAO
+{
+
+    /* Register Layer namespace. */
+    namespace Register
+    {
+
+        /* Forward declarations. */
+        class State;
+
+
+        /** Metrics
+         *
+         *  Chain-wide aggregates over all registers on disk. These are updated on every state
+         *  written to or erased from the register database, so they never require a scan.
+         *
+         **/
+        class Metrics
+        {
+        public:
+
+            /** Total account registers. **/
+            uint64_t nAccounts;
+
+
+            /** Total append registers. **/
+            uint64_t nAppend;
+
+
+            /** Total crypto registers, one per signature chain. **/
+            uint64_t nCrypto;
+
+
+            /** Total name registers. **/
+            uint64_t nNames;
+
+
+            /** Total name registers in the global namespace. **/
+            uint64_t nGlobalNames;
+
+
+            /** Total name registers in a user namespace. **/
+            uint64_t nNamespacedNames;
+
+
+            /** Total namespace registers. **/
+            uint64_t nNamespaces;
+
+
+            /** Total object registers. **/
+            uint64_t nObjects;
+
+
+            /** Total object registers owned by a token. **/
+            uint64_t nTokenized;
+
+
+            /** Total raw registers. **/
+            uint64_t nRaw;
+
+
+            /** Total readonly registers. **/
+            uint64_t nReadOnly;
+
+
+            /** Total token registers. **/
+            uint64_t nTokens;
+
+
+            /** Total trust registers with stake. **/
+            uint64_t nTrustKeys;
+
+
+            /** Total stake over all trust registers. **/
+            uint64_t nStake;
+
+
+            /** Total trust score over all trust registers with stake. **/
+            uint64_t nTrust;
+
+
+            /** Serialization **/
+            IMPLEMENT_SERIALIZE
+            (
+                READWRITE(nAccounts);
+                READWRITE(nAppend);
+                READWRITE(nCrypto);
+                READWRITE(nNames);
+                READWRITE(nGlobalNames);
+                READWRITE(nNamespacedNames);
+                READWRITE(nNamespaces);
+                READWRITE(nObjects);
+                READWRITE(nTokenized);
+                READWRITE(nRaw);
+                READWRITE(nReadOnly);
+                READWRITE(nTokens);
+                READWRITE(nTrustKeys);
+                READWRITE(nStake);
+                READWRITE(nTrust);
+            )
+
+
+            /** Default Constructor. **/
+            Metrics();
+
+
+            /** Add
+             *
+             *  Add a register state to the aggregates.
+             *
+             *  @param[in] nAddress The address type of the register.
+             *  @param[in] state The state of the register.
+             *
+             **/
+            void Add(const uint8_t nAddress, const State& state);
+
+
+            /** Remove
+             *
+             *  Remove a register state from the aggregates.
+             *
+             *  @param[in] nAddress The address type of the register.
+             *  @param[in] state The state of the register.
+             *
+             **/
+            void Remove(const uint8_t nAddress, const State& state);
+
+
+            /** Registers
+             *
+             *  Get the total registers counted by the metrics API.
+             *
+             **/
+            uint64_t Registers() const;
+
+
+        private:
+
+            /** update
+             *
+             *  Apply the contribution of a register state with given sign.
+             *
+             *  @param[in] nAddress The address type of the register.
+             *  @param[in] state The state of the register.
+             *  @param[in] nDelta The sign of the update, 1 to add or -1 to remove.
+             *
+             **/
+            void update(const uint8_t nAddress, const State& state, const int64_t nDelta);
+
+        };
+    }
+}
+
+#endif
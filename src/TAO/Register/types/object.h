@@ -16,6 +16,7 @@ ________________________________________________________________________________
 #define NEXUS_TAO_REGISTER_INCLUDE_OBJECT_H
 
 #include <TAO/Register/types/state.h>
+#include <TAO/Register/types/layout.h>
 #include <TAO/Register/include/enum.h>
 
 /* Global TAO namespace. */
@@ -38,8 +39,8 @@ namespace TAO
 
         public:
 
-            /** Internal map for managing object data members and their binary positions. **/
-            mutable std::map< std::string, std::pair<uint16_t, bool> > mapData; //internal map for data members
+            /** Shared layout of object data members and their binary positions, nullptr if not parsed. **/
+            std::shared_ptr<const Layout> pLayout;
 
 
             /** Default constructor. **/
@@ -190,33 +191,32 @@ namespace TAO
             template<typename Type>
             bool Read(const std::string& strName, Type& value) const
             {
-                /* Check the map for empty. */
-                if(mapData.empty())
+                /* Check the layout for empty. */
+                if(!pLayout)
                     return debug::error(FUNCTION, "object is not parsed");
 
-                /* Check that the name exists in the object. */
-                if(!mapData.count(strName))
-                    return false;
-
-                /* Find the binary position of value. */
-                nReadPos = mapData[strName].first;
-
-                /* Deserialize the type specifier. */
-                uint8_t nType;
-                *this >> nType;
-
-                /* Check for unsupported type enums. */
-                if(nType == TYPES::UNSUPPORTED)
-                    return debug::error(FUNCTION, "unsupported type");
+                return read_field(pLayout->Find(strName), value);
+            }
 
-                /* Check the expected type from read. */
-                if(type(value) != nType)
-                    return debug::error(FUNCTION, "type mismatch");
 
-                /* Deserialize the value. */
-                *this >> value;
+            /** Read
+             *
+             *  Read a value form the object register by standard field id.
+             *
+             *  @param[in] nField The field id from FIELDS enumeration.
+             *  @param[in] vData The data to read from the object.
+             *
+             *  @return True if the read was successful.
+             *
+             **/
+            template<typename Type>
+            bool Read(const uint8_t nField, Type& value) const
+            {
+                /* Check the layout for empty. */
+                if(!pLayout)
+                    return debug::error(FUNCTION, "object is not parsed");
 
-                return true;
+                return read_field(pLayout->Find(nField), value);
             }
 
 
@@ -233,37 +233,32 @@ namespace TAO
             template<typename Type>
             bool Write(const std::string& strName, const Type& value)
             {
-                /* Check that the name exists in the object. */
-                if(!mapData.count(strName))
-                    return false;
-
-                /* Check that the value is mutable (writes allowed). */
-                if(!mapData[strName].second)
-                    return debug::error(FUNCTION, "cannot set value for READONLY data member");
-
-                /* Find the binary position of value. */
-                nReadPos = mapData[strName].first;
-
-                /* Deserialize the type specifier. */
-                uint8_t nType;
-                *this >> nType;
-
-                /* Check for unsupported types. */
-                if(nType == TYPES::UNSUPPORTED)
-                    return debug::error(FUNCTION, "unsupported type");
+                /* Check the layout for empty. */
+                if(!pLayout)
+                    return debug::error(FUNCTION, "object is not parsed");
 
-                /* Check the type to helper templates. */
-                if(type(value) != nType)
-                    return debug::error(FUNCTION, "type mismatch");
+                return write_field(pLayout->Find(strName), value);
+            }
 
-                /* Get the expected size. */
-                if(nReadPos + sizeof(value) > vchState.size())
-                    return debug::error(FUNCTION, "performing an over-write");
 
-                /* Copy the bytes into the object. */
-                std::copy((uint8_t*)&value, (uint8_t*)&value + sizeof(value), (uint8_t*)&vchState[nReadPos]);
+            /** Write
+             *
+             *  Write into the object register a value by standard field id.
+             *
+             *  @param[in] nField The field id from FIELDS enumeration.
+             *  @param[in] value The data to write into the object.
+             *
+             *  @return True if the write was successful.
+             *
+             **/
+            template<typename Type>
+            bool Write(const uint8_t nField, const Type& value)
+            {
+                /* Check the layout for empty. */
+                if(!pLayout)
+                    return debug::error(FUNCTION, "object is not parsed");
 
-                return true;
+                return write_field(pLayout->Find(nField), value);
             }
 
 
@@ -340,8 +335,101 @@ namespace TAO
             }
 
 
+            /** get
+             *
+             *  Template to access a member variable of an object register by standard field id.
+             *
+             *  @param[in] nField The field id from FIELDS enumeration.
+             *
+             *  @return The value to access.
+             *
+             **/
+            template<typename Type>
+            Type get(const uint8_t nField) const
+            {
+                /* Declare the return value. */
+                Type ret;
+
+                /* Read the value from object. */
+                if(!Read(nField, ret))
+                    throw std::runtime_error(debug::safe_printstr(FUNCTION, "member access read failed"));
+
+                return ret;
+            }
+
+
         private:
 
+            /** read_field
+             *
+             *  Read a value from the object register at a given data member.
+             *
+             *  @param[in] pField The data member to read, nullptr if not found.
+             *  @param[out] value The value to read into.
+             *
+             *  @return True if the read was successful.
+             *
+             **/
+            template<typename Type>
+            bool read_field(const Layout::Field* pField, Type& value) const
+            {
+                /* Check that the name exists in the object. */
+                if(!pField)
+                    return false;
+
+                /* Check the expected type from read. */
+                if(type(value) != pField->nType)
+                    return debug::error(FUNCTION, "type mismatch");
+
+                /* Find the binary position of value. */
+                nReadPos = pField->nPosition + 1;
+
+                /* Deserialize the value. */
+                *this >> value;
+
+                return true;
+            }
+
+
+            /** write_field
+             *
+             *  Write a fixed size value into the object register at a given data member.
+             *
+             *  @param[in] pField The data member to write, nullptr if not found.
+             *  @param[in] value The data to write into the object.
+             *
+             *  @return True if the write was successful.
+             *
+             **/
+            template<typename Type>
+            bool write_field(const Layout::Field* pField, const Type& value)
+            {
+                /* Check that the name exists in the object. */
+                if(!pField)
+                    return false;
+
+                /* Check that the value is mutable (writes allowed). */
+                if(!pField->fMutable)
+                    return debug::error(FUNCTION, "cannot set value for READONLY data member");
+
+                /* Check the type to helper templates. */
+                if(type(value) != pField->nType)
+                    return debug::error(FUNCTION, "type mismatch");
+
+                /* Find the binary position of value. */
+                nReadPos = pField->nPosition + 1;
+
+                /* Get the expected size. */
+                if(nReadPos + sizeof(value) > vchState.size())
+                    return debug::error(FUNCTION, "performing an over-write");
+
+                /* Copy the bytes into the object. */
+                std::copy((uint8_t*)&value, (uint8_t*)&value + sizeof(value), (uint8_t*)&vchState[nReadPos]);
+
+                return true;
+            }
+
+
             /** type
              *
              *  Helper function that uses template deduction to find type enum.
@@ -21,9 +21,14 @@ ________________________________________________________________________________
 #include <Util/include/runtime.h>
 #include <Util/include/version.h>
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstdarg>
 #include <cstdio>
 #include <map>
+#include <memory>
+#include <thread>
 #include <vector>
 
 #include <iostream>
@@ -68,6 +73,301 @@ namespace debug
     /* The maximum size threshold of each log file. */
     uint32_t nLogSizeMB;
 
+    /* Bytes written to the current log file. */
+    uint64_t nLogBytes = 0;
+
+    /* Flag to write the log file as JSON lines. */
+    bool fLogJSON = false;
+
+
+    /** log_entry
+     *
+     *  A single log line waiting for the writer thread.
+     *
+     **/
+    struct log_entry
+    {
+        /** Global order the line was logged in. **/
+        uint64_t nSequence;
+
+        /** Time the line was logged in milliseconds. **/
+        uint64_t nTimestamp;
+
+        /** The log level. **/
+        uint32_t nLevel;
+
+        /** The formatted line. **/
+        std::string strLine;
+    };
+
+
+    /** log_buffer
+     *
+     *  Single producer, single consumer ring of log lines. Each logging thread owns one
+     *  and only the writer thread reads from it, so no locks are needed to log.
+     *
+     **/
+    struct log_buffer
+    {
+        /** Total lines the ring can hold, must be a power of two. **/
+        static const uint64_t SIZE = 1024;
+
+        /** The lines in the ring. **/
+        std::vector<log_entry> vEntries;
+
+        /** Next position for the writer thread to read. **/
+        std::atomic<uint64_t> nHead;
+
+        /** Next position for the owning thread to write. **/
+        std::atomic<uint64_t> nTail;
+
+        /** Identifier for the owning thread. **/
+        uint32_t nThread;
+
+        log_buffer(const uint32_t nThreadIn)
+        : vEntries (SIZE)
+        , nHead    (0)
+        , nTail    (0)
+        , nThread  (nThreadIn)
+        {
+        }
+    };
+
+
+    /* Mutex to protect the list of thread buffers. */
+    std::mutex BUFFERS_MUTEX;
+
+    /* Buffers for every thread that has logged. */
+    std::vector< std::shared_ptr<log_buffer> > vBuffers;
+
+    /* This thread's log buffer. */
+    thread_local std::shared_ptr<log_buffer> pBuffer;
+
+    /* Global sequence to keep lines from different threads in order. */
+    std::atomic<uint64_t> nSequence(0);
+
+    /* Flag to determine if the async writer is running. */
+    std::atomic<bool> fAsync(false);
+
+    /* Mutex to protect the cached time of day. */
+    std::mutex TIME_MUTEX;
+
+    /* The second our cached time of day was built for. */
+    uint64_t nCachedSecond = 0;
+
+    /* The cached time of day, so localtime is only called once per second. */
+    std::string strCachedTime;
+
+    /* Condition to wake the writer thread. */
+    std::condition_variable LOG_CONDITION;
+
+    /* The async writer thread. */
+    std::thread LOG_THREAD;
+
+
+    /** log_guard
+     *
+     *  Stops the writer thread on exit paths that never call Shutdown, since destroying
+     *  a joinable thread terminates the process.
+     *
+     **/
+    struct log_guard
+    {
+        ~log_guard()
+        {
+            fAsync.store(false);
+            LOG_CONDITION.notify_all();
+
+            if(LOG_THREAD.joinable())
+                LOG_THREAD.join();
+        }
+    } LOG_GUARD;
+
+
+    /* Builds the timestamp prefix, only formatting the local time when the second changes. */
+    std::string log_time(const uint64_t nTimestamp)
+    {
+        std::string strTime = "[";
+        {
+            LOCK(TIME_MUTEX);
+
+            /* Refresh our cached time of day. */
+            const uint64_t nSecond = nTimestamp / 1000;
+            if(nSecond != nCachedSecond || strCachedTime.empty())
+            {
+                time_t timestamp = static_cast<time_t>(nSecond);
+
+                {
+                    LOCK2(DEBUG_MUTEX); //gmtime and localtime are not thread safe together
+                    strCachedTime = safe_printstr(std::put_time(std::localtime(&timestamp), "%H:%M:%S"));
+                }
+
+                nCachedSecond = nSecond;
+            }
+
+            strTime += strCachedTime;
+        }
+
+        /* Add the milliseconds. */
+        const uint32_t nMillis = nTimestamp % 1000;
+
+        strTime += ".";
+        strTime += static_cast<char>('0' + (nMillis / 100));
+        strTime += static_cast<char>('0' + (nMillis / 10) % 10);
+        strTime += static_cast<char>('0' + (nMillis % 10));
+        strTime += "] ";
+
+        return strTime;
+    }
+
+
+    /* Encode a log line as a JSON object, dropping any ANSI color codes. */
+    void log_json(std::string& strOut, const log_entry& entry, const uint32_t nThread)
+    {
+        strOut += "{\"time\":" + std::to_string(entry.nTimestamp)
+                + ",\"level\":" + std::to_string(entry.nLevel)
+                + ",\"thread\":" + std::to_string(nThread)
+                + ",\"message\":\"";
+
+        for(uint64_t n = 0; n < entry.strLine.size(); ++n)
+        {
+            const char c = entry.strLine[n];
+
+            /* Skip over ANSI escape sequences. */
+            if(c == '\x1b')
+            {
+                while(n < entry.strLine.size() && entry.strLine[n] != 'm')
+                    ++n;
+
+                continue;
+            }
+
+            /* Escape JSON control characters. */
+            switch(c)
+            {
+                case '"':  strOut += "\\\""; break;
+                case '\\': strOut += "\\\\"; break;
+                case '\n': strOut += "\\n";  break;
+                case '\r': strOut += "\\r";  break;
+                case '\t': strOut += "\\t";  break;
+                default:
+                {
+                    if(static_cast<uint8_t>(c) < 0x20)
+                    {
+                        char buffer[8];
+                        snprintf(buffer, sizeof(buffer), "\\u%04x", static_cast<uint32_t>(c));
+                        strOut += buffer;
+                    }
+                    else
+                        strOut += c;
+                }
+            }
+        }
+
+        strOut += "\"}\n";
+    }
+
+
+    /* Drain all thread buffers and write them out in a single batch. */
+    void log_flush()
+    {
+        /* Grab the current list of buffers. */
+        std::vector< std::pair<log_entry, uint32_t> > vBatch;
+        {
+            LOCK(BUFFERS_MUTEX);
+
+            for(auto it = vBuffers.begin(); it != vBuffers.end(); )
+            {
+                log_buffer* pbuffer = it->get();
+
+                /* Check for exited threads before draining so we don't miss their last lines. */
+                const bool fExited = (it->use_count() == 1);
+
+                /* Read everything that has been published. */
+                const uint64_t nTail = pbuffer->nTail.load(std::memory_order_acquire);
+                uint64_t nHead = pbuffer->nHead.load(std::memory_order_relaxed);
+                for( ; nHead < nTail; ++nHead)
+                {
+                    log_entry& entry = pbuffer->vEntries[nHead & (log_buffer::SIZE - 1)];
+                    vBatch.push_back(std::make_pair(std::move(entry), pbuffer->nThread));
+                }
+
+                pbuffer->nHead.store(nHead, std::memory_order_release);
+
+                /* Remove buffers for threads that have exited. */
+                if(fExited)
+                    it = vBuffers.erase(it);
+                else
+                    ++it;
+            }
+        }
+
+        /* Check that we have something to write. */
+        if(vBatch.empty())
+            return;
+
+        /* Keep lines from different threads in the order they were logged. */
+        std::sort(vBatch.begin(), vBatch.end(),
+            [](const std::pair<log_entry, uint32_t>& a, const std::pair<log_entry, uint32_t>& b)
+            {
+                return a.first.nSequence < b.first.nSequence;
+            });
+
+        /* Build the output for console and file. */
+        std::string strConsole, strFile;
+        for(const auto& item : vBatch)
+        {
+            const std::string strTime = log_time(item.first.nTimestamp);
+
+            strConsole += strTime + item.first.strLine + "\n";
+            if(fLogJSON)
+                log_json(strFile, item.first, item.second);
+        }
+
+        /* Write the text output to file if not in JSON mode. */
+        if(!fLogJSON)
+            strFile = strConsole;
+
+        /* Lock so we don't interleave with synchronous writes. */
+        LOCK(DEBUG_MUTEX);
+
+        /* Dump it to the console. */
+        std::cout << strConsole << std::flush;
+
+        /* Write it to the debug file. */
+        if(ssFile.is_open())
+        {
+            ssFile << strFile << std::flush;
+            nLogBytes += strFile.size();
+
+            /* Check if the current file should be archived and take action. */
+            check_log_archive(ssFile);
+        }
+    }
+
+
+    /* The async writer thread, batching lines and flushing on an interval. */
+    void log_thread()
+    {
+        /* The interval to flush in milliseconds. */
+        const uint32_t nInterval = std::max(config::GetArg("-loginterval", 100), int64_t(1));
+
+        std::mutex CONDITION_MUTEX;
+        while(fAsync.load())
+        {
+            /* Sleep until our interval or a full buffer wakes us. */
+            {
+                std::unique_lock<std::mutex> CONDITION_LOCK(CONDITION_MUTEX);
+                LOG_CONDITION.wait_for(CONDITION_LOCK, std::chrono::milliseconds(nInterval));
+            }
+
+            log_flush();
+        }
+
+        /* Write anything left over before we exit. */
+        log_flush();
+    }
+
 
     /* Write startup information into the log file */
     void Initialize()
@@ -90,15 +390,37 @@ namespace debug
             return;
         }
 
+        /* Start our byte counter from the existing file size. */
+        ssFile.seekp(0, std::ios::end);
+        nLogBytes = static_cast<uint64_t>(ssFile.tellp());
+
         /* Get the debug logging configuration parameters (or default if none specified) */
         nLogFiles  = config::GetArg("-logfiles", 20);
         nLogSizeMB = config::GetArg("-logsizeMB", 5);
+        fLogJSON   = (config::GetArg("-logformat", "text") == "json");
+
+        /* Start the async writer. */
+        if(config::GetBoolArg("-logasync", true))
+        {
+            fAsync.store(true);
+            LOG_THREAD = std::thread(log_thread);
+        }
     }
 
 
     /*  Close the debug log file. */
     void Shutdown()
     {
+        /* Stop the async writer, which drains all buffers on exit. */
+        if(fAsync.load())
+        {
+            fAsync.store(false);
+            LOG_CONDITION.notify_all();
+        }
+
+        if(LOG_THREAD.joinable())
+            LOG_THREAD.join();
+
         LOCK(DEBUG_MUTEX);
 
         if(ssFile.is_open())
@@ -227,32 +549,80 @@ namespace debug
     }
 
 
-    /*  Writes log output to console and debug file with timestamps.
-     *  Encapsulated log for improved compile time. Not thread safe. */
-    void log_(time_t &timestamp, std::string &debug_str)
+    /*  Writes log output to console and debug file with timestamps. */
+    void log_(const uint32_t nLevel, std::string &debug_str)
     {
-        /* Build the timestamp */
-        std::string time_str = safe_printstr(
-            "[",
-            std::put_time(std::localtime(&timestamp), "%H:%M:%S"),
-            ".",
-            std::setfill('0'),
-            std::setw(3),
-            (runtime::timestamp(true) % 1000),
-            "] ");
+        /* Build our entry. */
+        log_entry entry;
+        entry.nSequence  = nSequence++;
+        entry.nTimestamp = runtime::timestamp(true);
+        entry.nLevel     = nLevel;
+        entry.strLine    = std::move(debug_str);
+
+        /* Hand the line to the writer thread. */
+        if(fAsync.load())
+        {
+            /* Register a buffer for this thread on first use. */
+            if(!pBuffer)
+            {
+                static std::atomic<uint32_t> nThreads(0);
+                pBuffer = std::make_shared<log_buffer>(++nThreads);
+
+                LOCK(BUFFERS_MUTEX);
+                vBuffers.push_back(pBuffer);
+            }
+
+            /* Wait for the writer if our buffer is full. */
+            const uint64_t nTail = pBuffer->nTail.load(std::memory_order_relaxed);
+            while(nTail - pBuffer->nHead.load(std::memory_order_acquire) >= log_buffer::SIZE)
+            {
+                /* Writer is shutting down, fall through to writing it ourselves. */
+                if(!fAsync.load())
+                    break;
+
+                LOG_CONDITION.notify_all();
+                std::this_thread::yield();
+            }
+
+            /* Publish the line if there is room. */
+            if(nTail - pBuffer->nHead.load(std::memory_order_acquire) < log_buffer::SIZE)
+            {
+                pBuffer->vEntries[nTail & (log_buffer::SIZE - 1)] = std::move(entry);
+                pBuffer->nTail.store(nTail + 1, std::memory_order_release);
+
+                return;
+            }
+        }
 
         /* Get the final timestamped debug string. */
-        std::string final_str = time_str + debug_str;
+        std::string final_str = log_time(entry.nTimestamp) + entry.strLine;
+
+        /* Otherwise write it synchronously. */
+        LOCK(DEBUG_MUTEX);
 
         /* Dump it to the console. */
         std::cout << final_str << std::endl;
 
         /* Write it to the debug file. */
-        ssFile << final_str << std::endl;
+        if(ssFile.is_open())
+        {
+            if(fLogJSON)
+            {
+                std::string strJSON;
+                log_json(strJSON, entry, 0);
+
+                ssFile << strJSON << std::flush;
+                nLogBytes += strJSON.size();
+            }
+            else
+            {
+                ssFile << final_str << std::endl;
+                nLogBytes += final_str.size() + 1;
+            }
+        }
 
         /* Check if the current file should be archived and take action. */
         check_log_archive(ssFile);
-
     }
 
 
@@ -272,17 +642,15 @@ namespace debug
         if(!outFile.is_open())
             return;
 
-        /* Get the current position to determine number of bytes. */
-        uint32_t nBytes = outFile.tellp();
-
         /* Get the max log size in bytes. */
-        uint32_t nMaxLogSizeBytes = nLogSizeMB << 20;
+        uint64_t nMaxLogSizeBytes = uint64_t(nLogSizeMB) << 20;
 
         /* Check if the log size is exceeded. */
-        if(nBytes > nMaxLogSizeBytes)
+        if(nLogBytes > nMaxLogSizeBytes)
         {
             /* Close the current debug.log file. */
             outFile.close();
+            nLogBytes = 0;
 
             /* Get the number of debug files. */
             uint32_t nDebugFiles = debug_filecount();
@@ -276,8 +276,8 @@ namespace filesystem
         int status = mkdir(path.c_str(), m);
     #endif
 
-        /* Handle failures. */
-        if(status < 0)
+        /* Handle failures, another thread may have created it since we checked. */
+        if(status < 0 && errno != EEXIST)
         {
             return debug::error(FUNCTION, "Failed to create directory: ", path, "\nReason: ", strerror(errno));
         }
@@ -180,10 +180,14 @@ namespace debug
     /** log_
      *
      *  Writes log output to console and debug file with timestamps.
-     *  Encapsulated log for improved compile time. Not thread safe.
+     *  Encapsulated log for improved compile time. When the async writer is running the
+     *  line is handed to this thread's log buffer, otherwise it is written under DEBUG_MUTEX.
+     *
+     *  @param[in] nLevel The log level being written.
+     *  @param[in] debug_str The formatted log line, moved from.
      *
      **/
-     void log_(time_t &timestamp, std::string &debug_str);
+     void log_(const uint32_t nLevel, std::string &debug_str);
 
 
     /** log
@@ -202,16 +206,10 @@ namespace debug
         if(config::nVerbose < nLevel)
             return;
 
-        /* Lock the mutex. */
-        LOCK(DEBUG_MUTEX);
-
-        /* Get the debug string and log file. */
+        /* Get the debug string outside of any locks. */
         std::string debug = safe_printstr(args...);
 
-        /* Get the timestamp. */
-        time_t timestamp = std::time(nullptr);
-
-        log_(timestamp, debug);
+        log_(nLevel, debug);
     }
 
 
@@ -362,7 +360,8 @@ namespace debug
      *  Checks if the current debug log should be closed and archived. This
      *  function will close the current file if the max file size is exceeded,
      *  rename it, and open a new file. It will delete the oldest file if it
-     *  exceeds the max number of files.
+     *  exceeds the max number of files. The size is tracked by a byte counter
+     *  rather than querying the file.
      *
      *  @param[in] outFile The output file stream used to update debug files
      *
@@ -18,6 +18,7 @@ ________________________________________________________________________________
 #include <Util/templates/serialize.h>
 
 #include <cstdint>
+#include <utility>
 #include <vector>
 
 
@@ -44,6 +45,58 @@ class DataStream
     uint32_t nSerVersion;
 
 
+    /** serialize_size
+     *
+     *  Terminates the variadic size pass.
+     *
+     **/
+    uint64_t serialize_size() const
+    {
+        return 0;
+    }
+
+
+    /** serialize_size
+     *
+     *  Get the total serialized size of the given objects.
+     *
+     *  @param[in] head The object being sized.
+     *  @param[in] tail The variadic parameters.
+     *
+     **/
+    template<typename Head, typename... Tail>
+    uint64_t serialize_size(const Head& head, const Tail&... tail) const
+    {
+        return ::GetSerializeSize(head, nSerType, nSerVersion) + serialize_size(tail...);
+    }
+
+
+    /** serialize_args
+     *
+     *  Terminates the variadic write pass.
+     *
+     **/
+    void serialize_args()
+    {
+    }
+
+
+    /** serialize_args
+     *
+     *  Serializes the given objects in order.
+     *
+     *  @param[in] head The object being written.
+     *  @param[in] tail The variadic parameters.
+     *
+     **/
+    template<typename Head, typename... Tail>
+    void serialize_args(const Head& head, const Tail&... tail)
+    {
+        ::Serialize(*this, head, nSerType, nSerVersion);
+        serialize_args(tail...);
+    }
+
+
 public:
 
     /** Default Constructor. **/
@@ -104,6 +157,50 @@ public:
     DataStream(const std::vector<char>& vchDataIn, const uint32_t nSerTypeIn, const uint32_t nSerVersionIn);
 
 
+    /** Copy Constructor **/
+    DataStream(const DataStream& stream)
+    : vData       (stream.vData)
+    , nReadPos    (stream.nReadPos)
+    , nSerType    (stream.nSerType)
+    , nSerVersion (stream.nSerVersion)
+    {
+    }
+
+
+    /** Move Constructor **/
+    DataStream(DataStream&& stream) noexcept
+    : vData       (std::move(stream.vData))
+    , nReadPos    (std::move(stream.nReadPos))
+    , nSerType    (std::move(stream.nSerType))
+    , nSerVersion (std::move(stream.nSerVersion))
+    {
+    }
+
+
+    /** Copy Assignment Operator **/
+    DataStream& operator=(const DataStream& stream)
+    {
+        vData       = stream.vData;
+        nReadPos    = stream.nReadPos;
+        nSerType    = stream.nSerType;
+        nSerVersion = stream.nSerVersion;
+
+        return *this;
+    }
+
+
+    /** Move Assignment Operator **/
+    DataStream& operator=(DataStream&& stream) noexcept
+    {
+        vData       = std::move(stream.vData);
+        nReadPos    = std::move(stream.nReadPos);
+        nSerType    = std::move(stream.nSerType);
+        nSerVersion = std::move(stream.nSerVersion);
+
+        return *this;
+    }
+
+
     /** Destructor. */
     ~DataStream()
     {
@@ -318,6 +415,28 @@ public:
     }
 
 
+    /** Encode
+     *
+     *  Serializes the given objects into the stream, sizing them first with GetSerializeSize
+     *  so that the stream grows with a single exact allocation rather than reallocating
+     *  as each object is written.
+     *
+     *  @param[in] args The objects to serialize.
+     *
+     **/
+    template<typename... Args>
+    DataStream& Encode(const Args&... args)
+    {
+        /* Allocate once for everything we are about to write. */
+        vData.reserve(vData.size() + serialize_size(args...));
+
+        /* Serialize to the stream. */
+        serialize_args(args...);
+
+        return (*this);
+    }
+
+
     /** Operator Overload >>
      *
      *  Serializes data into vchOperations.
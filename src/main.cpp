@@ -18,6 +18,7 @@ ________________________________________________________________________________
 #include <LLP/types/rpcnode.h>
 #include <LLP/types/miner.h>
 #include <LLP/include/lisp.h>
+#include <LLP/include/request_pool.h>
 #include <LLP/include/port.h>
 
 #include <LLD/include/global.h>
@@ -134,6 +135,17 @@ int main(int argc, char** argv)
         true,
         60000);
 
+    /* Startup the request workers shared by the RPC and API servers. */
+    uint32_t nWorkers = static_cast<uint32_t>(config::GetArg(std::string("-apiworkers"), 8));
+    LLP::REQUEST_POOL.store(new LLP::RequestPool(
+        nWorkers,
+
+        /* The maximum requests waiting before we respond busy (default 256). */
+        static_cast<uint32_t>(config::GetArg(std::string("-apiqueue"), 256)),
+
+        /* The maximum workers a single method can occupy (default half of the workers). */
+        static_cast<uint32_t>(config::GetArg(std::string("-apimethodthreads"), std::max(nWorkers / 2, 1u)))));
+
     /* Get the port for the Core API Server. */
     nPort = static_cast<uint16_t>(config::GetArg(std::string("-rpcport"), config::fTestNet.load() ? TESTNET_RPC_PORT : MAINNET_RPC_PORT));
 
@@ -164,12 +176,19 @@ int main(int argc, char** argv)
     uint32_t nElapsed = 0;
 
 
+    /* Startup phase timings in milliseconds. */
+    uint32_t nDatabaseTime = 0, nChainTime = 0, nWalletTime = 0;
+
+
     /* Check for failures. */
     bool fFailed = config::fShutdown.load();
     if(!fFailed)
     {
         /* Initialize LLD. */
+        uint32_t nPhaseStart = timer.ElapsedMilliseconds();
         LLD::Initialize();
+        nDatabaseTime = timer.ElapsedMilliseconds() - nPhaseStart;
+        nPhaseStart   = timer.ElapsedMilliseconds();
 
         /* Load the Wallet Database. NOTE this needs to be done before ChainState::Initialize as that can disconnect blocks causing
            the wallet to be accessed if they contain any legacy stake transactions */
@@ -178,7 +197,9 @@ int main(int argc, char** argv)
             return debug::error("Failed initializing wallet");
 
         /* Initialize ChainState. */
+        uint32_t nChainStart = timer.ElapsedMilliseconds();
         TAO::Ledger::ChainState::Initialize();
+        nChainTime = timer.ElapsedMilliseconds() - nChainStart;
 
 
         /* Initialize the scripts for legacy mode. */
@@ -211,6 +232,8 @@ int main(int argc, char** argv)
 
         /* Relay transactions. */
         Legacy::Wallet::GetInstance().ResendWalletTransactions();
+        nWalletTime = timer.ElapsedMilliseconds() - nPhaseStart - nChainTime;
+        nPhaseStart = timer.ElapsedMilliseconds();
 
 
         /* Get the port for Tritium Server. */
@@ -293,7 +316,8 @@ int main(int argc, char** argv)
 
 
         /* Startup performance metric. */
-        debug::log(0, FUNCTION, "Started up in ", nElapsed, "ms");
+        debug::log(0, FUNCTION, "Started up in ", nElapsed, "ms (databases ", nDatabaseTime, "ms, chain ", nChainTime,
+            "ms, wallet ", nWalletTime, "ms, servers ", nElapsed - nPhaseStart, "ms)");
 
 
         /* Set the initialized flags. */
@@ -340,6 +364,11 @@ int main(int argc, char** argv)
     timer.Reset();
 
 
+    /* Stop the request workers before the API they execute on. */
+    if(LLP::REQUEST_POOL.load())
+        LLP::REQUEST_POOL.load()->Stop();
+
+
     /* Shutdown the API. */
     TAO::API::Shutdown();
 
@@ -0,0 +1,111 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/include/runtime.h>
+#include <Util/include/debug.h>
+
+#include <LLC/include/random.h>
+#include <LLC/types/uint1024.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* Time the main arithmetic operations for a given width on half width operands, like chain trust and difficulty math. */
+template<uint32_t BITS>
+void BenchmarkUint()
+{
+    const uint32_t nTotal = 100000;
+
+    /* Build random operands, keeping products and dividends within the width. */
+    std::vector<base_uint<BITS>> vA, vB;
+    for(uint32_t n = 0; n < nTotal; ++n)
+    {
+        base_uint<BITS> a, b;
+        a.SetBytes(LLC::GetRand1024().GetBytes());
+        b.SetBytes(LLC::GetRand1024().GetBytes());
+
+        vA.push_back(a >> (BITS / 2));
+        vB.push_back((b >> (BITS / 2 + 32)) + 1);
+    }
+
+    uint64_t nCheck = 0;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nTotal; ++n)
+            nCheck += (vA[n] * vB[n]).Get64();
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "uint", BITS, "::Multiply::", ANSI_COLOR_RESET, nTotal / double(nTime), " million ops / second");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nTotal; ++n)
+            nCheck += (vA[n] / vB[n]).Get64();
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "uint", BITS, "::Divide::", ANSI_COLOR_RESET, nTotal / double(nTime), " million ops / second");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nTotal; ++n)
+            nCheck += (vA[n] / (vB[n].Get64() | 1)).Get64();
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "uint", BITS, "::Divide64::", ANSI_COLOR_RESET, nTotal / double(nTime), " million ops / second");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nTotal; ++n)
+            nCheck += (vA[n] + vB[n]).Get64();
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "uint", BITS, "::Add::", ANSI_COLOR_RESET, nTotal / double(nTime), " million ops / second");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nTotal; ++n)
+            nCheck += (vA[n] < vB[n]) + (vA[n] == vB[n]);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "uint", BITS, "::Compare::", ANSI_COLOR_RESET, nTotal / double(nTime), " million ops / second");
+    }
+
+    /* Keep the work from being optimized away. */
+    REQUIRE(nCheck != 0);
+}
+
+
+TEST_CASE( "Base Uint Arithmetic Benchmarks", "[LLC]")
+{
+    debug::log(0, "===== Begin Base Uint Arithmetic Benchmarks =====");
+
+    BenchmarkUint<256>();
+    BenchmarkUint<512>();
+    BenchmarkUint<1024>();
+
+    debug::log(0, "===== End Base Uint Arithmetic Benchmarks =====\n");
+}
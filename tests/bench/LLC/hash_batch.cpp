@@ -0,0 +1,62 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/include/runtime.h>
+#include <Util/include/debug.h>
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/batch.h>
+#include <LLC/hash/macro.h>
+#include <LLC/include/random.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "SK512 Batch Benchmarks", "[LLC]")
+{
+    debug::log(0, "===== Begin SK512 Batch Benchmarks =====");
+
+    /* Build merkle leaves like a large block. */
+    const uint32_t nTotal = 100000;
+
+    std::vector<uint512_t> vLeaves;
+    for(uint32_t n = 0; n < nTotal * 2; ++n)
+        vLeaves.push_back(LLC::GetRand512());
+
+    std::vector<uint512_t> vScalar(nTotal);
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nTotal; ++n)
+            vScalar[n] = LLC::SK512(BEGIN(vLeaves[n * 2]), END(vLeaves[n * 2]), BEGIN(vLeaves[n * 2 + 1]), END(vLeaves[n * 2 + 1]));
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "SK512::Pairs::", ANSI_COLOR_RESET, nTotal / double(nTime), " million hashes / second");
+    }
+
+    std::vector<uint512_t> vBatch(nTotal);
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        LLC::SK512Batch((const uint8_t*)vLeaves.data(), 128, nTotal, vBatch.data());
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "SK512Batch::Pairs::", ANSI_COLOR_RESET, nTotal / double(nTime), " million hashes / second (", LLC::SK512Lanes(), " lanes)");
+    }
+
+    REQUIRE(vBatch == vScalar);
+
+    debug::log(0, "===== End SK512 Batch Benchmarks =====\n");
+}
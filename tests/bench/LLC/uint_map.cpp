@@ -0,0 +1,85 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/include/runtime.h>
+#include <Util/include/debug.h>
+
+#include <LLC/include/random.h>
+#include <LLC/types/uint1024.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <map>
+#include <unordered_map>
+
+
+/* Time inserts, lookups and erases of the given keys in a map type. */
+template<typename MapType>
+void BenchmarkMap(const std::string& strName, const std::vector<uint512_t>& vKeys)
+{
+    MapType mapTest;
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& hash : vKeys)
+            mapTest[hash] = hash.Get64();
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, strName, "::Insert::", ANSI_COLOR_RESET, vKeys.size() / double(nTime), " million records / second");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        uint64_t nFound = 0;
+        for(const auto& hash : vKeys)
+            nFound += mapTest.count(hash);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, strName, "::Count::", ANSI_COLOR_RESET, vKeys.size() / double(nTime), " million records / second");
+
+        REQUIRE(nFound == vKeys.size());
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(const auto& hash : vKeys)
+            mapTest.erase(hash);
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, strName, "::Erase::", ANSI_COLOR_RESET, vKeys.size() / double(nTime), " million records / second");
+
+        REQUIRE(mapTest.empty());
+    }
+}
+
+
+TEST_CASE( "Base Uint Map Benchmarks", "[LLC]")
+{
+    debug::log(0, "===== Begin Base Uint Map Benchmarks =====");
+
+    /* Build random keys like the transaction hashes used by the mempool. */
+    std::vector<uint512_t> vKeys;
+    for(uint32_t n = 0; n < 100000; ++n)
+        vKeys.push_back(LLC::GetRand512());
+
+    BenchmarkMap<std::map<uint512_t, uint64_t>>("map", vKeys);
+    BenchmarkMap<std::unordered_map<uint512_t, uint64_t>>("unordered_map", vKeys);
+
+    debug::log(0, "===== End Base Uint Map Benchmarks =====\n");
+}
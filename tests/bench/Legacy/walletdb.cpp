@@ -0,0 +1,130 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/include/runtime.h>
+#include <Util/include/debug.h>
+#include <Util/include/mutex.h>
+
+#include <LLC/include/random.h>
+
+#include <Legacy/types/keypoolentry.h>
+#include <Legacy/types/wallettx.h>
+#include <Legacy/wallet/wallet.h>
+#include <Legacy/wallet/walletdb.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Wallet Database Benchmarks", "[Legacy]")
+{
+    debug::log(0, "===== Begin Wallet Database Benchmarks =====");
+
+    /* Open the wallet database, it may already be open. */
+    Legacy::Wallet::InitializeWallet(Legacy::WalletDB::DEFAULT_WALLET_DB);
+    Legacy::WalletDB walletdb(Legacy::WalletDB::DEFAULT_WALLET_DB);
+
+    const uint32_t nTotal = 100000;
+
+    /* Use pool indexes well past any real key pool. */
+    const uint64_t nFirst = 1000000000;
+
+    /* Build the entries to write, with keys about the size of a public key. */
+    std::vector<Legacy::KeyPoolEntry> vEntries;
+    for(uint32_t n = 0; n < nTotal; ++n)
+        vEntries.push_back(Legacy::KeyPoolEntry(LLC::GetRand256().GetBytes()));
+
+    uint32_t nWritten = 0;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        for(uint32_t n = 0; n < nTotal; ++n)
+            nWritten += walletdb.WritePool(nFirst + n, vEntries[n]);
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "WalletDB::WritePool::", ANSI_COLOR_RESET, nTotal * 1000.0 / (nTime > 0 ? nTime : 1), " writes / second");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        Legacy::WalletBatch batch(walletdb);
+        for(uint32_t n = 0; n < nTotal; ++n)
+            nWritten += walletdb.WritePool(nFirst + nTotal + n, vEntries[n]);
+        REQUIRE(batch.Commit());
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "WalletDB::WritePool::Batch::", ANSI_COLOR_RESET, nTotal * 1000.0 / (nTime > 0 ? nTime : 1), " writes / second");
+    }
+
+    /* Check the batched writes were committed, and clean up. */
+    REQUIRE(nWritten == nTotal * 2);
+
+    Legacy::KeyPoolEntry entry;
+    REQUIRE(walletdb.ReadPool(nFirst + nTotal, entry));
+
+    {
+        Legacy::WalletBatch batch(walletdb);
+        for(uint64_t n = 0; n < nTotal * 2; ++n)
+            walletdb.ErasePool(nFirst + n);
+        REQUIRE(batch.Commit());
+    }
+
+    REQUIRE_FALSE(walletdb.ReadPool(nFirst + nTotal, entry));
+
+    /* Time loading a wallet file holding the transactions of a long lived wallet. */
+    Legacy::Wallet& wallet = Legacy::Wallet::GetInstance();
+
+    std::vector<uint512_t> vHashes;
+    {
+        Legacy::WalletTx wtx;
+        wtx.vout.push_back(Legacy::TxOut(1000000, Legacy::Script()));
+        wtx.vout.push_back(Legacy::TxOut(2000000, Legacy::Script()));
+
+        Legacy::WalletBatch batch(walletdb);
+        for(uint32_t n = 0; n < nTotal; ++n)
+        {
+            vHashes.push_back(LLC::GetRand512());
+            REQUIRE(walletdb.WriteTx(vHashes.back(), wtx));
+        }
+        REQUIRE(batch.Commit());
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        REQUIRE(walletdb.LoadWallet(wallet) == Legacy::DB_LOAD_OK);
+
+        uint64_t nTime = timer.ElapsedMilliseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "WalletDB::LoadWallet::", ANSI_COLOR_RESET, nTotal, " transactions in ", nTime, " ms");
+    }
+
+    /* Check the transactions were loaded, and clean up. */
+    {
+        RLOCK(wallet.cs_wallet);
+
+        REQUIRE(wallet.mapWallet.count(vHashes.back()));
+
+        Legacy::WalletBatch batch(walletdb);
+        for(const auto& hash : vHashes)
+        {
+            walletdb.EraseTx(hash);
+            wallet.mapWallet.erase(hash);
+        }
+        REQUIRE(batch.Commit());
+    }
+
+    debug::log(0, "===== End Wallet Database Benchmarks =====\n");
+}
@@ -25,7 +25,7 @@ TEST_CASE( "Object Register Benchmarks", "[register]")
 
         for(int i = 0; i < 1000000; i++)
         {
-            object.mapData.clear();
+            object.pLayout = nullptr;
             REQUIRE(object.Parse());
         }
 
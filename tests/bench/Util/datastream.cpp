@@ -0,0 +1,144 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <Util/include/runtime.h>
+#include <Util/include/debug.h>
+
+#include <LLC/include/random.h>
+
+#include <LLP/include/version.h>
+
+#include <TAO/Ledger/types/tritium.h>
+
+#include <Util/templates/datastream.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+/* Byte stream with the same growth as a datastream, counting every reallocation of its buffer. */
+class GrowthStream
+{
+    std::vector<uint8_t> vData;
+
+public:
+
+    uint32_t nSerType;
+    uint32_t nSerVersion;
+    uint32_t nAllocations;
+
+    GrowthStream(const uint64_t nReserve)
+    : vData        ( )
+    , nSerType     (SER_NETWORK)
+    , nSerVersion  (LLP::MIN_PROTO_VERSION)
+    , nAllocations (0)
+    {
+        if(nReserve > 0)
+        {
+            vData.reserve(nReserve);
+            ++nAllocations;
+        }
+    }
+
+    GrowthStream& write(const char* pch, const uint64_t nSize)
+    {
+        const uint64_t nCapacity = vData.capacity();
+        vData.insert(vData.end(), (uint8_t*)pch, (uint8_t*)pch + nSize);
+
+        if(vData.capacity() != nCapacity)
+            ++nAllocations;
+
+        return *this;
+    }
+
+    template<typename Type>
+    GrowthStream& operator<<(const Type& obj)
+    {
+        ::Serialize(*this, obj, nSerType, nSerVersion);
+        return *this;
+    }
+};
+
+
+TEST_CASE( "DataStream Encode Benchmarks", "[Util]")
+{
+    debug::log(0, "===== Begin DataStream Encode Benchmarks =====");
+
+    /* Build a block like the ones pushed during sync and relay. */
+    TAO::Ledger::TritiumBlock block;
+    block.vchBlockSig.resize(144);
+    for(uint32_t n = 0; n < 2000; ++n)
+        block.vtx.push_back(std::make_pair(uint8_t(TAO::Ledger::TRANSACTION::TRITIUM), LLC::GetRand512()));
+
+    const uint64_t nSize = ::GetSerializeSize(block, uint32_t(SER_NETWORK), LLP::MIN_PROTO_VERSION);
+
+    /* Count the buffer allocations when growing as we write, and when sized up front. */
+    {
+        GrowthStream ssGrowth(0);
+        ssGrowth << block;
+
+        GrowthStream ssSized(nSize);
+        ssSized << block;
+
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Block::Allocations::", ANSI_COLOR_RESET,
+            ssGrowth.nAllocations, " growing, ", ssSized.nAllocations, " sized for ", nSize, " bytes");
+
+        REQUIRE(ssSized.nAllocations == 1);
+    }
+
+    const uint32_t nTotal = 5000;
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        uint64_t nBytes = 0;
+        for(uint32_t n = 0; n < nTotal; ++n)
+        {
+            DataStream ssData(SER_NETWORK, LLP::MIN_PROTO_VERSION);
+            ssData << block;
+
+            nBytes += ssData.size();
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Block::Stream::", ANSI_COLOR_RESET, nTotal, " blocks in ", nTime, " microseconds (", nBytes / double(nTime), " MB / second)");
+    }
+
+    {
+        runtime::timer timer;
+        timer.Start();
+
+        uint64_t nBytes = 0;
+        for(uint32_t n = 0; n < nTotal; ++n)
+        {
+            DataStream ssData(SER_NETWORK, LLP::MIN_PROTO_VERSION);
+            ssData.Encode(block);
+
+            nBytes += ssData.size();
+        }
+
+        uint64_t nTime = timer.ElapsedMicroseconds();
+        debug::log(0, ANSI_COLOR_BRIGHT_CYAN, "Block::Encode::", ANSI_COLOR_RESET, nTotal, " blocks in ", nTime, " microseconds (", nBytes / double(nTime), " MB / second)");
+    }
+
+    /* Both paths must produce the same bytes. */
+    DataStream ssStream(SER_NETWORK, LLP::MIN_PROTO_VERSION);
+    ssStream << block;
+
+    DataStream ssEncode(SER_NETWORK, LLP::MIN_PROTO_VERSION);
+    ssEncode.Encode(block);
+
+    REQUIRE(ssEncode.Bytes() == ssStream.Bytes());
+    REQUIRE(ssEncode.Bytes().capacity() == nSize);
+
+    debug::log(0, "===== End DataStream Encode Benchmarks =====\n");
+}
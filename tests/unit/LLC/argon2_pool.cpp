@@ -0,0 +1,115 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <unit/catch2/catch.hpp>
+
+#include <LLC/include/argon2_pool.h>
+
+#include <thread>
+#include <vector>
+
+/* Build a context for given output and inputs. */
+argon2_context make_context(std::vector<uint8_t>& vHash, std::vector<uint8_t>& vPassword,
+                            std::vector<uint8_t>& vSalt, const uint32_t nMemory)
+{
+    argon2_context context =
+    {
+        &vHash[0], static_cast<uint32_t>(vHash.size()),
+        &vPassword[0], static_cast<uint32_t>(vPassword.size()),
+        &vSalt[0], static_cast<uint32_t>(vSalt.size()),
+        NULL, 0,
+        NULL, 0,
+        2,
+        nMemory,
+        1, 1,
+        ARGON2_VERSION_13,
+        NULL, NULL,
+        ARGON2_DEFAULT_FLAGS
+    };
+
+    return context;
+}
+
+
+TEST_CASE( "LLC::Argon2Pool", "[argon2]")
+{
+    std::vector<uint8_t> vPassword = {'p', 'a', 's', 's', 'w', 'o', 'r', 'd', 1, 2, 3, 4};
+    std::vector<uint8_t> vSalt     = {'u', 's', 'e', 'r', 'n', 'a', 'm', 'e', 0, 0, 0, 0};
+
+    /* Reference hash with argon2's own allocator. */
+    std::vector<uint8_t> vExpected(64);
+    argon2_context context = make_context(vExpected, vPassword, vSalt, 256);
+    REQUIRE(argon2id_ctx(&context) == ARGON2_OK);
+
+    SECTION("Pooled hashes match and reuse arenas")
+    {
+        LLC::Argon2Pool pool(1, 256 * 1024);
+
+        for(uint32_t n = 0; n < 3; ++n)
+        {
+            std::vector<uint8_t> vHash(64);
+            argon2_context pooled = make_context(vHash, vPassword, vSalt, 256);
+            REQUIRE(pool.Hash(pooled) == ARGON2_OK);
+            REQUIRE(vHash == vExpected);
+        }
+
+        LLC::Argon2Pool::Stats stats = pool.GetStats();
+        REQUIRE(stats.nDerived   == 3);
+        REQUIRE(stats.nArenas    == 1);
+        REQUIRE(stats.nOversized == 0);
+    }
+
+    SECTION("Hashes larger than an arena use the heap")
+    {
+        LLC::Argon2Pool pool(1, 64 * 1024);
+
+        std::vector<uint8_t> vHash(64);
+        argon2_context pooled = make_context(vHash, vPassword, vSalt, 256);
+        REQUIRE(pool.Hash(pooled) == ARGON2_OK);
+        REQUIRE(vHash == vExpected);
+
+        REQUIRE(pool.GetStats().nOversized == 1);
+    }
+
+    SECTION("Concurrent hashes are capped by the arenas")
+    {
+        LLC::Argon2Pool pool(2, 256 * 1024);
+
+        std::vector<std::vector<uint8_t>> vHashes(8, std::vector<uint8_t>(64));
+        std::vector<std::thread> vThreads;
+        for(uint32_t n = 0; n < vHashes.size(); ++n)
+        {
+            vThreads.push_back(std::thread([&pool, &vHashes, &vPassword, &vSalt, n]
+            {
+                std::vector<uint8_t> vPasswordCopy = vPassword;
+                std::vector<uint8_t> vSaltCopy     = vSalt;
+
+                argon2_context pooled = make_context(vHashes[n], vPasswordCopy, vSaltCopy, 256);
+                pool.Hash(pooled);
+            }));
+        }
+
+        for(auto& thread : vThreads)
+            thread.join();
+
+        for(const auto& vHash : vHashes)
+        {
+            REQUIRE(vHash == vExpected);
+        }
+
+        LLC::Argon2Pool::Stats stats = pool.GetStats();
+        REQUIRE(stats.nDerived == 8);
+        REQUIRE(stats.nArenas  <= 2);
+        REQUIRE(stats.nWaiting == 0);
+    }
+}
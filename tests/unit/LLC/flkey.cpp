@@ -0,0 +1,78 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/flkey.h>
+#include <LLC/include/random.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "Falcon Expanded Key Tests", "[LLC]")
+{
+    LLC::FLKey key;
+    key.MakeNewKey();
+    REQUIRE(key.IsValid());
+
+    /* Sign some messages under the same key. */
+    std::vector<std::vector<uint8_t>> vMessages;
+    std::vector<std::vector<uint8_t>> vSigs;
+    for(uint32_t n = 0; n < 4; ++n)
+    {
+        std::vector<uint8_t> vchData = LLC::GetRand512().GetBytes();
+
+        std::vector<uint8_t> vchSig;
+        REQUIRE(key.Sign(vchData, vchSig));
+
+        vMessages.push_back(vchData);
+        vSigs.push_back(vchSig);
+    }
+
+    /* Verify through fresh keys, the second round hitting the expanded key cache. */
+    for(uint32_t nRound = 0; nRound < 2; ++nRound)
+    {
+        for(uint32_t n = 0; n < vMessages.size(); ++n)
+        {
+            LLC::FLKey keyVerify;
+            REQUIRE(keyVerify.SetPubKey(key.GetPubKey()));
+
+            REQUIRE(keyVerify.Verify(vMessages[n], vSigs[n]));
+            REQUIRE_FALSE(keyVerify.Verify(vMessages[(n + 1) % vMessages.size()], vSigs[n]));
+        }
+    }
+
+    /* Verify directly against the expanded key. */
+    std::vector<uint8_t> vchExpanded;
+    REQUIRE(LLC::FLKey::ExpandPubKey(key.GetPubKey(), vchExpanded));
+    REQUIRE(vchExpanded.size() == FALCON_EXPANDEDPUBKEY_SIZE(9));
+
+    for(uint32_t n = 0; n < vMessages.size(); ++n)
+    {
+        REQUIRE(LLC::FLKey::VerifyExpanded(vchExpanded, vMessages[n], vSigs[n]));
+    }
+
+    /* Tampered signatures must fail. */
+    std::vector<uint8_t> vchBad = vSigs[0];
+    vchBad.back() ^= 0x01;
+    REQUIRE_FALSE(LLC::FLKey::VerifyExpanded(vchExpanded, vMessages[0], vchBad));
+    REQUIRE_FALSE(LLC::FLKey::VerifyExpanded(vchExpanded, vMessages[0], std::vector<uint8_t>()));
+
+    /* Malformed public keys can't be expanded or verified against. */
+    std::vector<uint8_t> vchPubKey = key.GetPubKey();
+    vchPubKey.pop_back();
+    REQUIRE_FALSE(LLC::FLKey::ExpandPubKey(vchPubKey, vchExpanded));
+    REQUIRE(vchExpanded.empty());
+
+    LLC::FLKey keyBad;
+    keyBad.SetPubKey(vchPubKey);
+    REQUIRE_FALSE(keyBad.Verify(vMessages[0], vSigs[0]));
+}
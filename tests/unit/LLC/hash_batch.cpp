@@ -0,0 +1,74 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/batch.h>
+#include <LLC/hash/macro.h>
+#include <LLC/include/random.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "SK512 Batch Tests", "[LLC]")
+{
+    /* Equal length batches across the skein block boundaries, with a leftover message for the scalar path. */
+    for(uint32_t nLength = 0; nLength < 200; nLength += 9)
+    {
+        const uint32_t nCount = 7;
+
+        std::vector<uint8_t> vData(nLength * nCount);
+        for(auto& nByte : vData)
+            nByte = static_cast<uint8_t>(LLC::GetRand(256));
+
+        std::vector<uint512_t> vHashes(nCount);
+        LLC::SK512Batch(vData.data(), nLength, nCount, vHashes.data());
+
+        for(uint32_t n = 0; n < nCount; ++n)
+        {
+            std::vector<uint8_t> vMessage(vData.begin() + n * nLength, vData.begin() + (n + 1) * nLength);
+            REQUIRE(vHashes[n] == LLC::SK512(vMessage));
+        }
+    }
+
+    /* Merkle pairs of 512-bit leaves. */
+    std::vector<uint512_t> vLeaves;
+    for(uint32_t n = 0; n < 16; ++n)
+        vLeaves.push_back(LLC::GetRand512());
+
+    std::vector<uint512_t> vPairs(8);
+    LLC::SK512Batch((const uint8_t*)vLeaves.data(), 128, 8, vPairs.data());
+    for(uint32_t n = 0; n < 8; ++n)
+    {
+        REQUIRE(vPairs[n] == LLC::SK512(BEGIN(vLeaves[n * 2]), END(vLeaves[n * 2]), BEGIN(vLeaves[n * 2 + 1]), END(vLeaves[n * 2 + 1])));
+    }
+
+    /* Mixed length messages. */
+    std::vector<std::vector<uint8_t>> vMessages;
+    for(uint32_t n = 0; n < 23; ++n)
+    {
+        std::vector<uint8_t> vMessage((n / 5) * 33);
+        for(auto& nByte : vMessage)
+            nByte = static_cast<uint8_t>(LLC::GetRand(256));
+
+        vMessages.push_back(vMessage);
+    }
+
+    const std::vector<uint512_t> vMixed = LLC::SK512Batch(vMessages);
+    REQUIRE(vMixed.size() == vMessages.size());
+    for(uint32_t n = 0; n < vMessages.size(); ++n)
+    {
+        REQUIRE(vMixed[n] == LLC::SK512(vMessages[n]));
+    }
+
+    REQUIRE(LLC::SK512Lanes() >= 1);
+}
@@ -0,0 +1,55 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/hash/SK.h>
+#include <LLC/hash/writer.h>
+#include <LLC/include/random.h>
+
+#include <Util/templates/datastream.h>
+
+#include <unit/catch2/catch.hpp>
+
+
+TEST_CASE( "SK Hash Writer Tests", "[LLC]")
+{
+    /* Hash the same objects through a data stream and a hash writer across the skein block boundaries. */
+    for(uint32_t nSize = 0; nSize < 300; nSize += 7)
+    {
+        std::vector<uint8_t> vData(nSize);
+        for(auto& nByte : vData)
+            nByte = static_cast<uint8_t>(LLC::GetRand(256));
+
+        const uint64_t nValue = LLC::GetRand();
+        const uint512_t hashValue = LLC::GetRand512();
+
+        DataStream ssData(SER_GETHASH, 1);
+        ssData << nValue << vData << hashValue;
+
+        LLC::SKHashWriter<256> ss256(SER_GETHASH, 1);
+        ss256 << nValue << vData << hashValue;
+        REQUIRE(ss256.GetHash() == LLC::SK256(ssData.begin(), ssData.end()));
+
+        LLC::SKHashWriter<512> ss512(SER_GETHASH, 1);
+        ss512 << nValue << vData << hashValue;
+        REQUIRE(ss512.GetHash() == LLC::SK512(ssData.begin(), ssData.end()));
+
+        LLC::SKHashWriter<1024> ss1024(SER_GETHASH, 1);
+        ss1024 << nValue << vData << hashValue;
+        REQUIRE(ss1024.GetHash() == LLC::SK1024(ssData.begin(), ssData.end()));
+    }
+
+    /* Nothing written matches the hash of no data. */
+    std::vector<uint8_t> vEmpty;
+    LLC::SKHashWriter<512> ssEmpty(SER_GETHASH, 1);
+    REQUIRE(ssEmpty.GetHash() == LLC::SK512(vEmpty.begin(), vEmpty.end()));
+}
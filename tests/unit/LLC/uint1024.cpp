@@ -16,6 +16,8 @@ ________________________________________________________________________________
 #include <LLC/include/random.h>
 #include <unit/catch2/catch.hpp>
 
+#include <unordered_set>
+
 
 using namespace LLC;
 
@@ -191,3 +193,34 @@ TEST_CASE( "Base Uint Math Tests", "[LLC]")
     }
 
 }
+
+
+TEST_CASE( "Base Uint Hash Tests", "[LLC]")
+{
+    /* Equal values must hash equally. */
+    uint1024_t a = GetRand1024();
+    uint1024_t b = a;
+    REQUIRE(std::hash<uint1024_t>()(a) == std::hash<uint1024_t>()(b));
+
+    /* A change in any word should change the hash. */
+    for(uint32_t n = 0; n < 1024; n += 32)
+    {
+        REQUIRE(std::hash<uint1024_t>()(a ^ (uint1024_t(1) << n)) != std::hash<uint1024_t>()(a));
+    }
+
+    /* Widths that aren't a multiple of 64 bits include their last word. */
+    uint1056_t c = 0;
+    REQUIRE(std::hash<uint1056_t>()(c) != std::hash<uint1056_t>()(c + (uint1056_t(1) << 1024)));
+
+    /* Unordered containers find what was inserted. */
+    std::unordered_set<uint256_t> setHashes;
+    for(uint32_t n = 0; n < 1000; ++n)
+        setHashes.insert(uint256_t(n));
+
+    REQUIRE(setHashes.size() == 1000);
+    for(uint32_t n = 0; n < 1000; ++n)
+    {
+        REQUIRE(setHashes.count(uint256_t(n)) == 1);
+    }
+    REQUIRE(setHashes.count(uint256_t(1000)) == 0);
+}
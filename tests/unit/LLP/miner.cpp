@@ -0,0 +1,160 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <unit/catch2/catch.hpp>
+#include <unit/TAO/API/util.h>
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <LLP/include/global.h>
+#include <LLP/types/miner.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+
+#include <Util/include/args.h>
+#include <Util/include/convert.h>
+
+#include <algorithm>
+#include <sys/socket.h>
+#include <unistd.h>
+
+
+/* Mining packet headers used below. */
+const uint8_t SET_CHANNEL = 3;
+const uint8_t SUBSCRIBE   = 65;
+const uint8_t NEW_ROUND   = 204;
+
+
+/* Reads the headers of every packet the miner has written to its end of the socket pair. */
+std::vector<uint8_t> ReadHeaders(int32_t nSocket)
+{
+    std::vector<uint8_t> vHeaders;
+
+    std::vector<uint8_t> vBuffer(1024 * 1024);
+    const int32_t nRead = recv(nSocket, &vBuffer[0], vBuffer.size(), MSG_DONTWAIT);
+    for(int32_t n = 0; n < nRead; )
+    {
+        const uint8_t nHeader = vBuffer[n++];
+        vHeaders.push_back(nHeader);
+
+        /* Skip the length and data of data packets. */
+        if(nHeader < 128)
+        {
+            const uint32_t nLength = (vBuffer[n] << 24) | (vBuffer[n + 1] << 16) | (vBuffer[n + 2] << 8) | vBuffer[n + 3];
+            n += 4 + nLength;
+        }
+    }
+
+    return vHeaders;
+}
+
+
+/* Processes a data packet on the miner as if a worker had sent it. */
+bool Request(LLP::Miner& miner, uint8_t nHeader, uint32_t nValue)
+{
+    miner.INCOMING.HEADER = nHeader;
+    miner.INCOMING.DATA   = convert::uint2bytes(nValue);
+    miner.INCOMING.LENGTH = miner.INCOMING.DATA.size();
+
+    return miner.ProcessPacket();
+}
+
+
+TEST_CASE( "LLP::Miner", "[miner]")
+{
+    /* Keep the state we change so the rest of the suite runs as before. */
+    const bool fMultiuser    = config::fMultiuser.load();
+    const bool fDNS          = config::mapArgs.count("-dns");
+    const std::string strDNS = fDNS ? config::mapArgs["-dns"] : "";
+    const uint1024_t hashBestChain = TAO::Ledger::ChainState::hashBestChain.load();
+
+    /* Mining is served to the single user session, which relays its auth to the tritium server on login. */
+    config::fMultiuser = false;
+    config::mapArgs["-dns"] = "0";
+    LLP::TRITIUM_SERVER = new LLP::Server<LLP::TritiumNode>(8888, 1, 30, false, 0, 0, 60, false, false, false, false);
+
+    /* Unlock for transactions only, so the miner neither builds blocks nor waits on notifications. */
+    json::json params;
+    params["username"] = "MINER" + std::to_string(LLC::GetRand());
+    params["password"] = PASSWORD;
+    params["pin"]      = PIN;
+
+    json::json ret = APICall("users/create/user", params);
+    REQUIRE(ret.find("result") != ret.end());
+
+    uint256_t hashGenesis;
+    hashGenesis.SetHex(ret["result"]["genesis"].get<std::string>());
+
+    uint512_t hashTx;
+    hashTx.SetHex(ret["result"]["hash"].get<std::string>());
+    REQUIRE(LLD::Ledger->WriteGenesis(hashGenesis, hashTx));
+
+    ret = APICall("users/login/user", params);
+    REQUIRE(ret.find("result") != ret.end());
+
+    params["transactions"] = "true";
+    ret = APICall("users/unlock/user", params);
+    REQUIRE(ret.find("result") != ret.end());
+
+    SECTION("Subscribed workers are pushed a new round on a new best block at the same height")
+    {
+        int32_t nSockets[2];
+        REQUIRE(socketpair(AF_UNIX, SOCK_STREAM, 0, nSockets) == 0);
+        {
+            LLP::Miner miner(LLP::Socket(nSockets[0], LLP::BaseAddress()), nullptr, false);
+
+            REQUIRE(Request(miner, SET_CHANNEL, 2));
+            REQUIRE(Request(miner, SUBSCRIBE, 1));
+
+            /* The first event starts the round at the current height. */
+            miner.Event(LLP::EVENT_GENERIC);
+            ReadHeaders(nSockets[1]);
+
+            /* A new best block at the same height ends the round. */
+            TAO::Ledger::ChainState::hashBestChain.store(LLC::GetRand1024());
+
+            miner.Event(LLP::EVENT_GENERIC);
+
+            std::vector<uint8_t> vHeaders = ReadHeaders(nSockets[1]);
+            REQUIRE(std::count(vHeaders.begin(), vHeaders.end(), NEW_ROUND) == 1);
+
+            /* The height signal that follows for polling workers doesn't push the round again. */
+            miner.Event(LLP::EVENT_GENERIC);
+
+            vHeaders = ReadHeaders(nSockets[1]);
+            REQUIRE(std::count(vHeaders.begin(), vHeaders.end(), NEW_ROUND) == 0);
+        }
+
+        close(nSockets[0]);
+        close(nSockets[1]);
+    }
+
+    /* Put everything back. */
+    TAO::Ledger::ChainState::hashBestChain.store(hashBestChain);
+
+    params.clear();
+    ret = APICall("users/logout/user", params);
+    REQUIRE(ret.find("result") != ret.end());
+
+    delete LLP::TRITIUM_SERVER;
+    LLP::TRITIUM_SERVER = nullptr;
+
+    if(fDNS)
+        config::mapArgs["-dns"] = strDNS;
+    else
+        config::mapArgs.erase("-dns");
+
+    config::fMultiuser = fMultiuser;
+}
@@ -0,0 +1,126 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <unit/catch2/catch.hpp>
+
+#include <LLP/include/request_pool.h>
+
+#include <atomic>
+#include <mutex>
+#include <vector>
+
+TEST_CASE( "LLP::RequestPool", "[request_pool]")
+{
+    SECTION("Requests from one connection run in order")
+    {
+        LLP::RequestPool pool(4, 64, 4);
+
+        std::mutex ORDER_MUTEX;
+        std::vector<uint32_t> vOrder;
+        std::atomic<uint32_t> nDone(0);
+
+        int nStrand = 0;
+        for(uint32_t n = 0; n < 16; ++n)
+        {
+            REQUIRE(pool.Submit("test/order", &nStrand, [n, &ORDER_MUTEX, &vOrder, &nDone]
+            {
+                runtime::sleep(1);
+                {
+                    std::lock_guard<std::mutex> lock(ORDER_MUTEX);
+                    vOrder.push_back(n);
+                }
+                ++nDone;
+            }));
+        }
+
+        while(nDone.load() < 16)
+            runtime::sleep(1);
+
+        REQUIRE(vOrder.size() == 16);
+        for(uint32_t n = 0; n < 16; ++n)
+        {
+            REQUIRE(vOrder[n] == n);
+        }
+
+        std::map<std::string, LLP::RequestPool::Stats> mapStats = pool.GetStats();
+        REQUIRE(mapStats["test/order"].nCompleted == 16);
+        REQUIRE(mapStats["test/order"].nActive == 0);
+    }
+
+
+    SECTION("Methods are limited in the workers they occupy")
+    {
+        LLP::RequestPool pool(4, 64, 2);
+
+        std::atomic<uint32_t> nActive(0);
+        std::atomic<uint32_t> nPeak(0);
+        std::atomic<uint32_t> nDone(0);
+
+        std::vector<int> vStrands(8);
+        for(uint32_t n = 0; n < 8; ++n)
+        {
+            REQUIRE(pool.Submit("test/slow", &vStrands[n], [&nActive, &nPeak, &nDone]
+            {
+                uint32_t nNow = ++nActive;
+                uint32_t nMax = nPeak.load();
+                while(nNow > nMax && !nPeak.compare_exchange_weak(nMax, nNow)) { }
+
+                runtime::sleep(5);
+                --nActive;
+                ++nDone;
+            }));
+        }
+
+        while(nDone.load() < 8)
+            runtime::sleep(1);
+
+        REQUIRE(nPeak.load() <= 2);
+    }
+
+
+    SECTION("Full queue rejects new requests")
+    {
+        LLP::RequestPool pool(1, 2, 1);
+
+        std::atomic<bool> fRelease(false);
+        std::atomic<uint32_t> nDone(0);
+
+        std::vector<int> vStrands(4);
+        auto fnBlock = [&fRelease, &nDone]
+        {
+            while(!fRelease.load())
+                runtime::sleep(1);
+
+            ++nDone;
+        };
+
+        /* The first request occupies the only worker. */
+        REQUIRE(pool.Submit("test/block", &vStrands[0], fnBlock));
+        while(pool.Pending() != 0)
+            runtime::sleep(1);
+
+        REQUIRE(pool.Submit("test/block", &vStrands[1], fnBlock));
+        REQUIRE(pool.Submit("test/block", &vStrands[2], fnBlock));
+        REQUIRE_FALSE(pool.Submit("test/block", &vStrands[3], fnBlock));
+
+        fRelease = true;
+        while(nDone.load() < 3)
+            runtime::sleep(1);
+
+        REQUIRE(pool.GetStats()["test/block"].nRejected == 1);
+
+        /* Stopped pools reject everything. */
+        pool.Stop();
+        REQUIRE_FALSE(pool.Submit("test/block", &vStrands[0], fnBlock));
+    }
+}
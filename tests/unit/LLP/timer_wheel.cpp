@@ -0,0 +1,60 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <unit/catch2/catch.hpp>
+
+#include <LLP/include/timer_wheel.h>
+
+TEST_CASE( "LLP::TimerWheel", "[timer_wheel]")
+{
+    LLP::TimerWheel wheel(100, 8);
+
+    const uint64_t nStart = 1000000;
+    std::vector<uint32_t> vExpired;
+
+    /* First pass initializes the wheel. */
+    wheel.Expire(nStart, vExpired);
+    REQUIRE(vExpired.empty());
+
+    wheel.Schedule(1, nStart + 100);
+    wheel.Schedule(2, nStart + 2000); //more than one rotation out
+    wheel.Schedule(3, nStart + 200);
+    wheel.Cancel(3);
+
+    /* Timers never fire early. */
+    wheel.Expire(nStart + 99, vExpired);
+    REQUIRE(vExpired.empty());
+
+    wheel.Expire(nStart + 100, vExpired);
+    REQUIRE(vExpired.size() == 1);
+    REQUIRE(vExpired[0] == 1);
+
+    /* Cancelled and future timers stay quiet. */
+    wheel.Expire(nStart + 1900, vExpired);
+    REQUIRE(vExpired.empty());
+
+    wheel.Expire(nStart + 2500, vExpired);
+    REQUIRE(vExpired.size() == 1);
+    REQUIRE(vExpired[0] == 2);
+
+    /* Rescheduling replaces the previous deadline. */
+    wheel.Schedule(4, nStart + 2600);
+    wheel.Schedule(4, nStart + 2700);
+
+    wheel.Expire(nStart + 2600, vExpired);
+    REQUIRE(vExpired.empty());
+
+    wheel.Expire(nStart + 2700, vExpired);
+    REQUIRE(vExpired.size() == 1);
+    REQUIRE(vExpired[0] == 4);
+}
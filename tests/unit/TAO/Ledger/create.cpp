@@ -0,0 +1,183 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <LLC/include/random.h>
+
+#include <LLD/include/global.h>
+
+#include <LLP/include/version.h>
+
+#include <TAO/Operation/include/enum.h>
+
+#include <TAO/Register/include/create.h>
+#include <TAO/Register/types/address.h>
+
+#include <TAO/Ledger/include/chainstate.h>
+#include <TAO/Ledger/include/constants.h>
+#include <TAO/Ledger/include/create.h>
+#include <TAO/Ledger/include/enum.h>
+#include <TAO/Ledger/types/mempool.h>
+#include <TAO/Ledger/types/sigchain.h>
+#include <TAO/Ledger/types/tritium.h>
+
+#include <Util/include/runtime.h>
+
+#include <unit/catch2/catch.hpp>
+
+#include <algorithm>
+
+
+/* Builds a signed transaction creating a token on a new signature chain. */
+TAO::Ledger::Transaction TemplateTx(const uint64_t nTimestamp, TAO::Register::Address& hashToken)
+{
+    using namespace TAO::Register;
+    using namespace TAO::Operation;
+
+    const std::string strUser = "testtemplate" + std::to_string(LLC::GetRand());
+    uint512_t hashPrivKey1  = LLC::GetRand512();
+    uint512_t hashPrivKey2  = LLC::GetRand512();
+
+    //create the transaction object
+    TAO::Ledger::Transaction tx;
+    tx.hashGenesis = TAO::Ledger::SignatureChain::Genesis(SecureString(strUser.c_str()));
+    tx.nSequence   = 0;
+    tx.nTimestamp  = nTimestamp;
+    tx.nKeyType    = TAO::Ledger::SIGNATURE::BRAINPOOL;
+    tx.nNextType   = TAO::Ledger::SIGNATURE::BRAINPOOL;
+    tx.NextHash(hashPrivKey2, TAO::Ledger::SIGNATURE::BRAINPOOL);
+
+    //payload
+    hashToken = TAO::Register::Address(TAO::Register::Address::TOKEN);
+    Object token = CreateToken(hashToken, 1000, 100);
+    tx[0] << uint8_t(OP::CREATE) << hashToken << uint8_t(REGISTER::OBJECT) << token.GetState();
+
+    //generate the prestates and poststates
+    REQUIRE(tx.Build());
+
+    //sign
+    tx.Sign(hashPrivKey1);
+
+    return tx;
+}
+
+
+/* Checks whether a block holds a transaction. */
+bool HasTx(const TAO::Ledger::TritiumBlock& block, const uint512_t& hash)
+{
+    return std::find(block.vtx.begin(), block.vtx.end(), std::make_pair(uint8_t(TAO::Ledger::TRANSACTION::TRITIUM), hash))
+        != block.vtx.end();
+}
+
+
+TEST_CASE( "Block template tests", "[ledger]")
+{
+    const uint1024_t hashBestChain = TAO::Ledger::ChainState::hashBestChain.load();
+
+    TAO::Register::Address hashToken1;
+    TAO::Ledger::Transaction tx1 = TemplateTx(runtime::unifiedtimestamp(), hashToken1);
+
+    TAO::Register::Address hashToken2;
+    TAO::Ledger::Transaction tx2 = TemplateTx(runtime::unifiedtimestamp(), hashToken2);
+
+    REQUIRE(TAO::Ledger::mempool.Accept(tx1));
+    REQUIRE(TAO::Ledger::mempool.Accept(tx2));
+
+    //a changed pool builds a new template
+    TAO::Ledger::TritiumBlock block;
+    TAO::Ledger::AddTransactions(block);
+    REQUIRE(HasTx(block, tx1.GetHash()));
+    REQUIRE(HasTx(block, tx2.GetHash()));
+
+    const std::vector<std::pair<uint8_t, uint512_t> > vTemplate = block.vtx;
+
+    //an unchanged best chain and pool reuse it
+    {
+        TAO::Ledger::TritiumBlock block2;
+        TAO::Ledger::AddTransactions(block2);
+        REQUIRE(block2.vtx == vTemplate);
+    }
+
+    //a block with a larger base size only takes the transactions that fit
+    {
+        const uint64_t nEntrySize =
+            ::GetSerializeSize(std::make_pair(uint8_t(0), uint512_t(0)), uint32_t(SER_NETWORK), LLP::PROTOCOL_VERSION);
+
+        //size the block so the whole template is 30 bytes over the limit
+        const uint64_t nCount    = vTemplate.size();
+        const uint64_t nBaseSize = TAO::Ledger::MAX_BLOCK_SIZE - 256 + 30 + 1 - GetSizeOfCompactSize(nCount) - nCount * nEntrySize;
+
+        TAO::Ledger::TritiumBlock block2;
+        const uint64_t nEmptySize = ::GetSerializeSize(block2, SER_NETWORK, LLP::PROTOCOL_VERSION);
+        block2.vchBlockSig.resize(nBaseSize - nEmptySize + 1 - GetSizeOfCompactSize(nBaseSize));
+        REQUIRE(::GetSerializeSize(block2, SER_NETWORK, LLP::PROTOCOL_VERSION) == nBaseSize);
+
+        TAO::Ledger::AddTransactions(block2);
+        REQUIRE(block2.vtx.size() == nCount - 1);
+        REQUIRE(std::equal(block2.vtx.begin(), block2.vtx.end(), vTemplate.begin()));
+    }
+
+    //removing a transaction rebuilds it
+    REQUIRE(TAO::Ledger::mempool.Remove(tx2.GetHash()));
+
+    TAO::Ledger::AddTransactions(block);
+    REQUIRE(HasTx(block, tx1.GetHash()));
+    REQUIRE_FALSE(HasTx(block, tx2.GetHash()));
+
+    //accepting it again rebuilds it
+    REQUIRE(TAO::Ledger::mempool.Accept(tx2));
+
+    TAO::Ledger::AddTransactions(block);
+    REQUIRE(HasTx(block, tx2.GetHash()));
+
+    //a register taken on disk doesn't change the template while the best chain is the same
+    REQUIRE(LLD::Register->WriteState(hashToken1, TAO::Register::State()));
+
+    TAO::Ledger::AddTransactions(block);
+    REQUIRE(HasTx(block, tx1.GetHash()));
+
+    //a new best chain rebuilds it without the transaction that no longer connects
+    TAO::Ledger::ChainState::hashBestChain.store(LLC::GetRand1024());
+
+    TAO::Ledger::AddTransactions(block);
+    REQUIRE_FALSE(HasTx(block, tx1.GetHash()));
+    REQUIRE(HasTx(block, tx2.GetHash()));
+
+    //a transaction too far in the future is left out
+    TAO::Register::Address hashToken3;
+    UNIFIED_AVERAGE_OFFSET += 60;
+    TAO::Ledger::Transaction tx3 = TemplateTx(runtime::unifiedtimestamp(), hashToken3);
+    REQUIRE(TAO::Ledger::mempool.Accept(tx3));
+    UNIFIED_AVERAGE_OFFSET -= 60;
+
+    TAO::Ledger::AddTransactions(block);
+    REQUIRE_FALSE(HasTx(block, tx3.GetHash()));
+
+    TAO::Ledger::AddTransactions(block);
+    REQUIRE_FALSE(HasTx(block, tx3.GetHash()));
+
+    //the template is rebuilt with it once it comes due
+    UNIFIED_AVERAGE_OFFSET += 60;
+
+    TAO::Ledger::AddTransactions(block);
+    REQUIRE(HasTx(block, tx3.GetHash()));
+
+    UNIFIED_AVERAGE_OFFSET -= 60;
+
+    //clean up
+    REQUIRE(TAO::Ledger::mempool.Remove(tx1.GetHash()));
+    REQUIRE(TAO::Ledger::mempool.Remove(tx2.GetHash()));
+    REQUIRE(TAO::Ledger::mempool.Remove(tx3.GetHash()));
+    REQUIRE(LLD::Register->EraseState(hashToken1));
+
+    TAO::Ledger::ChainState::hashBestChain.store(hashBestChain);
+}
@@ -488,6 +488,24 @@ TEST_CASE( "Mempool and memory sequencing tests", "[mempool]")
         }
 
 
+        {
+            //check the pending chain by genesis ends at the last transaction
+            REQUIRE(TAO::Ledger::mempool.Has(hashGenesis));
+
+            TAO::Ledger::Transaction txLast;
+            REQUIRE(TAO::Ledger::mempool.Get(hashGenesis, txLast));
+            REQUIRE(txLast.GetHash() == hashPrevTx);
+
+            std::vector<TAO::Ledger::Transaction> vtx;
+            REQUIRE(TAO::Ledger::mempool.Get(hashGenesis, vtx));
+            REQUIRE(vtx.back().GetHash() == hashPrevTx);
+            for(uint32_t n = 1; n < vtx.size(); ++n)
+            {
+                REQUIRE(vtx[n].hashPrevTx == vtx[n - 1].GetHash());
+            }
+        }
+
+
         {
             //check mempool list sequencing
             std::vector<uint512_t> vHashes;
@@ -1676,3 +1694,49 @@ TEST_CASE( "Mempool and memory sequencing tests", "[mempool]")
         TAO::Ledger::mempool.Check();
     }
 }
+
+
+TEST_CASE( "Mempool sequence tests", "[mempool]")
+{
+    using namespace TAO::Register;
+    using namespace TAO::Operation;
+
+    uint256_t hashGenesis   = TAO::Ledger::SignatureChain::Genesis("testsequence");
+    uint512_t hashPrivKey1  = LLC::GetRand512();
+    uint512_t hashPrivKey2  = LLC::GetRand512();
+
+    //create the transaction object
+    TAO::Ledger::Transaction tx;
+    tx.hashGenesis = hashGenesis;
+    tx.nSequence   = 0;
+    tx.nTimestamp  = runtime::timestamp();
+    tx.nKeyType    = TAO::Ledger::SIGNATURE::BRAINPOOL;
+    tx.nNextType   = TAO::Ledger::SIGNATURE::BRAINPOOL;
+    tx.NextHash(hashPrivKey2, TAO::Ledger::SIGNATURE::BRAINPOOL);
+
+    //payload
+    TAO::Register::Address hashToken = TAO::Register::Address(TAO::Register::Address::TOKEN);
+    Object token = CreateToken(hashToken, 1000, 100);
+    tx[0] << uint8_t(OP::CREATE) << hashToken << uint8_t(REGISTER::OBJECT) << token.GetState();
+
+    //generate the prestates and poststates
+    REQUIRE(tx.Build());
+
+    //sign
+    tx.Sign(hashPrivKey1);
+
+    //accepting a transaction changes the pool sequence
+    uint64_t nSequence = TAO::Ledger::mempool.Sequence();
+    REQUIRE(TAO::Ledger::mempool.Accept(tx));
+    REQUIRE(TAO::Ledger::mempool.Sequence() != nSequence);
+
+    //removing it changes the sequence again
+    nSequence = TAO::Ledger::mempool.Sequence();
+    REQUIRE(TAO::Ledger::mempool.Remove(tx.GetHash()));
+    REQUIRE(TAO::Ledger::mempool.Sequence() != nSequence);
+
+    //a failed remove leaves it alone
+    nSequence = TAO::Ledger::mempool.Sequence();
+    REQUIRE_FALSE(TAO::Ledger::mempool.Remove(tx.GetHash()));
+    REQUIRE(TAO::Ledger::mempool.Sequence() == nSequence);
+}
@@ -13,6 +13,9 @@ ________________________________________________________________________________
 
 #include <TAO/Ledger/include/constants.h>
 #include <TAO/Ledger/include/stake.h>
+#include <TAO/Ledger/types/tritium.h>
+
+#include <LLC/include/random.h>
 
 #include <Util/include/softfloat.h>
 
@@ -257,3 +260,44 @@ TEST_CASE( "Proof of Stake Tests", "[ledger]")
         REQUIRE(nRequired == 8.0);
     }
 }
+
+
+TEST_CASE( "Stake Search Tests", "[ledger]")
+{
+    TAO::Ledger::TritiumBlock block;
+    block.nVersion      = 7;
+    block.hashPrevBlock = LLC::GetRand1024();
+    block.nChannel      = 0;
+    block.nHeight       = 3000000;
+    block.nBits         = 0x7c0fffff;
+    block.nNonce        = 1;
+    block.producer.hashGenesis = LLC::GetRand256();
+
+    /* Find the lowest stake hash over a range of nonces to use as the target. */
+    uint1024_t hashLowest = ~uint1024_t(0);
+    uint64_t nLowest = 0;
+    for(uint64_t nNonce = 1; nNonce <= 500; ++nNonce)
+    {
+        block.nNonce = nNonce;
+
+        uint1024_t hashStake = block.StakeHash();
+        if(hashStake < hashLowest)
+        {
+            hashLowest = hashStake;
+            nLowest    = nNonce;
+        }
+    }
+
+    /* The search finds the same nonce and hash from the midstate. */
+    uint1024_t hashProof = 0;
+    block.nNonce = 1;
+    REQUIRE(block.StakeSearch(hashLowest, 500, hashProof));
+    REQUIRE(block.nNonce == nLowest);
+    REQUIRE(hashProof == hashLowest);
+    REQUIRE(block.StakeHash() == hashProof);
+
+    /* A search that misses leaves the block one past the last nonce. */
+    block.nNonce = 1;
+    REQUIRE_FALSE(block.StakeSearch(hashLowest, nLowest - 1, hashProof));
+    REQUIRE(block.nNonce == nLowest);
+}
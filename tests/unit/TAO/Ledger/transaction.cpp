@@ -11,7 +11,12 @@
 
 ____________________________________________________________________________________________*/
 
+#include <LLC/include/random.h>
+
+#include <TAO/Operation/include/enum.h>
+
 #include <TAO/Ledger/types/transaction.h>
+#include <TAO/Ledger/types/transaction_view.h>
 
 #include <unit/catch2/catch.hpp>
 
@@ -39,3 +44,53 @@ TEST_CASE( "Transaction::operator<", "[ledger]" )
     REQUIRE(tx1 < tx2);
     REQUIRE_FALSE(tx2 < tx1);
 }
+
+
+//test lazily decoded transaction view
+TEST_CASE( "TransactionView::operator[]", "[ledger]" )
+{
+    TAO::Ledger::Transaction tx;
+    tx.nSequence   = 7;
+    tx.nTimestamp  = 1000;
+    tx.hashGenesis = LLC::GetRand256();
+    tx.hashPrevTx  = LLC::GetRand512();
+    tx.vchPubKey   = std::vector<uint8_t>(64, 1);
+    tx.vchSig      = std::vector<uint8_t>(32, 2);
+
+    /* Contracts with differing stream lengths. */
+    for(uint32_t n = 0; n < 5; ++n)
+    {
+        tx[n] << uint8_t(TAO::Operation::OP::DEBIT) << LLC::GetRand256() << LLC::GetRand256() << uint64_t(n);
+        if(n % 2 == 0)
+            tx[n] <= uint8_t(TAO::Operation::OP::GREATERTHAN) << uint64_t(n);
+    }
+
+    DataStream ssTx(SER_LLD, 1);
+    ssTx << tx;
+
+    const uint512_t hashTx = tx.GetHash();
+    TAO::Ledger::TransactionView view(hashTx);
+    ssTx >> view;
+
+    /* Check the ledger layer. */
+    REQUIRE(view.Size()       == tx.Size());
+    REQUIRE(view.nSequence    == tx.nSequence);
+    REQUIRE(view.nTimestamp   == tx.nTimestamp);
+    REQUIRE(view.hashGenesis  == tx.hashGenesis);
+    REQUIRE(view.hashPrevTx   == tx.hashPrevTx);
+    REQUIRE(ssTx.End());
+
+    /* Check the contracts decode and bind the same, out of order. */
+    const TAO::Ledger::Transaction& ref = tx;
+    for(int32_t n = 4; n >= 0; --n)
+    {
+        REQUIRE(view[n].Operations() == ref[n].Operations());
+        REQUIRE(view[n].Conditions() == ref[n].Conditions());
+        REQUIRE(view[n].Hash()       == ref[n].Hash());
+        REQUIRE(view[n].Caller()     == ref[n].Caller());
+        REQUIRE(view[n].Timestamp()  == ref[n].Timestamp());
+    }
+
+    /* Check out of bounds. */
+    REQUIRE_THROWS(view[5]);
+}
@@ -541,6 +541,49 @@ TEST_CASE( "Conditions Tests", "[condition]" )
            Condition script = Condition(contract, caller);
            REQUIRE(script.Execute());
        }
+
+
+       //a register read repeatedly in one condition evaluates and costs the same as reading it each time
+       contract.Clear();
+       contract <= uint8_t(OP::TYPES::UINT256_T) <= hashObject <= uint8_t(OP::REGISTER::VALUE) <= std::string("byte")
+                   <= uint8_t(OP::EQUALS) <= uint8_t(OP::TYPES::UINT8_T) <= uint8_t(55);
+
+       uint64_t nCostByte = 0;
+       {
+           Condition script = Condition(contract, caller);
+           REQUIRE(script.Execute());
+
+           nCostByte = script.nCost;
+       }
+
+       contract.Clear();
+       contract <= uint8_t(OP::TYPES::UINT256_T) <= hashObject <= uint8_t(OP::REGISTER::VALUE) <= std::string("balance")
+                   <= uint8_t(OP::EQUALS) <= uint8_t(OP::TYPES::UINT64_T) <= uint64_t(55);
+
+       uint64_t nCostBalance = 0;
+       {
+           Condition script = Condition(contract, caller);
+           REQUIRE(script.Execute());
+
+           nCostBalance = script.nCost;
+       }
+
+       contract <= uint8_t(OP::AND) <= uint8_t(OP::TYPES::UINT256_T) <= hashObject <= uint8_t(OP::REGISTER::VALUE) <= std::string("balance")
+                   <= uint8_t(OP::EQUALS) <= uint8_t(OP::TYPES::UINT64_T) <= uint64_t(55);
+       contract <= uint8_t(OP::AND) <= uint8_t(OP::TYPES::UINT256_T) <= hashObject <= uint8_t(OP::REGISTER::VALUE) <= std::string("byte")
+                   <= uint8_t(OP::EQUALS) <= uint8_t(OP::TYPES::UINT8_T) <= uint8_t(55);
+       {
+           Condition script = Condition(contract, caller);
+           REQUIRE(script.Execute());
+           REQUIRE(script.nCost == nCostBalance * 2 + nCostByte);
+       }
+
+       contract <= uint8_t(OP::AND) <= uint8_t(OP::TYPES::UINT256_T) <= hashObject <= uint8_t(OP::REGISTER::VALUE) <= std::string("balance")
+                   <= uint8_t(OP::EQUALS) <= uint8_t(OP::TYPES::UINT64_T) <= uint64_t(54);
+       {
+           Condition script = Condition(contract, caller);
+           REQUIRE_FALSE(script.Execute());
+       }
     }
 
 
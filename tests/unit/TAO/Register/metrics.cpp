@@ -0,0 +1,71 @@
+/*__________________________________________________________________________________________
+
+            (c) Hash(BEGIN(Satoshi[2010]), END(Sunny[2012])) == Videlicet[2014] ++
+
+            (c) Copyright The Nexus Developers 2014 - 2019
+
+            Distributed under the MIT software license, see the accompanying
+            file COPYING or http://www.opensource.org/licenses/mit-license.php.
+
+            "ad vocem populi" - To the Voice of the People
+
+____________________________________________________________________________________________*/
+
+#include <TAO/Register/include/create.h>
+#include <TAO/Register/types/address.h>
+#include <TAO/Register/types/metrics.h>
+#include <TAO/Register/types/object.h>
+
+#include <unit/catch2/catch.hpp>
+
+TEST_CASE( "Register Metrics Tests", "[register]")
+{
+    using namespace TAO::Register;
+
+    Metrics metrics;
+
+    //accounts only count by address type
+    Object account = CreateAccount(0);
+    metrics.Add(Address::ACCOUNT, account);
+    REQUIRE(metrics.nAccounts == 1);
+    REQUIRE(metrics.Registers() == 1);
+
+    //trust accounts without stake are not counted
+    Object trust = CreateTrust();
+    metrics.Add(Address::TRUST, trust);
+    REQUIRE(metrics.nTrustKeys == 0);
+
+    //trust accounts with stake add their stake and trust
+    Object trustNext = CreateTrust();
+    REQUIRE(trustNext.Parse());
+    REQUIRE(trustNext.Write("stake", uint64_t(500)));
+    REQUIRE(trustNext.Write("trust", uint64_t(20)));
+
+    metrics.Remove(Address::TRUST, trust);
+    metrics.Add(Address::TRUST, trustNext);
+    REQUIRE(metrics.nTrustKeys == 1);
+    REQUIRE(metrics.nStake == 500);
+    REQUIRE(metrics.nTrust == 20);
+
+    //names are split by namespace
+    metrics.Add(Address::NAME, CreateName(NAMESPACE::GLOBAL, "global", 0));
+    metrics.Add(Address::NAME, CreateName("space", "namespaced", 0));
+    metrics.Add(Address::NAME, CreateName("", "local", 0));
+    REQUIRE(metrics.nNames == 3);
+    REQUIRE(metrics.nGlobalNames == 1);
+    REQUIRE(metrics.nNamespacedNames == 1);
+    REQUIRE(metrics.Registers() == 5);
+
+    //removing everything returns to zero
+    metrics.Remove(Address::TRUST, trustNext);
+    metrics.Remove(Address::ACCOUNT, account);
+    metrics.Remove(Address::NAME, CreateName(NAMESPACE::GLOBAL, "global", 0));
+    metrics.Remove(Address::NAME, CreateName("space", "namespaced", 0));
+    metrics.Remove(Address::NAME, CreateName("", "local", 0));
+
+    REQUIRE(metrics.Registers() == 0);
+    REQUIRE(metrics.nStake == 0);
+    REQUIRE(metrics.nTrust == 0);
+    REQUIRE(metrics.nGlobalNames == 0);
+    REQUIRE(metrics.nNamespacedNames == 0);
+}
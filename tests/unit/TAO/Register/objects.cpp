@@ -262,3 +262,81 @@ TEST_CASE( "Object Register Tests", "[register]")
         REQUIRE(vRead == vBytes);
     }
 }
+
+
+TEST_CASE( "Object Register Layout Tests", "[register]")
+{
+    using namespace TAO::Register;
+
+    //standard objects share a single layout
+    {
+        Object account1;
+        account1 << std::string("balance") << uint8_t(TYPES::MUTABLE) << uint8_t(TYPES::UINT64_T) << uint64_t(55)
+                 << std::string("token")   << uint8_t(TYPES::UINT256_T) << uint256_t(0);
+
+        Object account2;
+        account2 << std::string("balance") << uint8_t(TYPES::MUTABLE) << uint8_t(TYPES::UINT64_T) << uint64_t(77)
+                 << std::string("token")   << uint8_t(TYPES::UINT256_T) << uint256_t(1);
+
+        REQUIRE(account1.Parse());
+        REQUIRE(account2.Parse());
+
+        //check layouts
+        REQUIRE(account1.pLayout == account2.pLayout);
+        REQUIRE(account1.Standard() == OBJECTS::ACCOUNT);
+
+        //check field id access
+        REQUIRE(account1.get<uint64_t>(FIELDS::BALANCE) == 55);
+        REQUIRE(account2.get<uint64_t>(FIELDS::BALANCE) == 77);
+        REQUIRE(account2.get<uint256_t>(FIELDS::TOKEN) == 1);
+        REQUIRE_THROWS(account1.get<uint64_t>(FIELDS::SUPPLY));
+
+        //check field id writes
+        REQUIRE(account1.Write(FIELDS::BALANCE, uint64_t(99)));
+        REQUIRE(account1.get<uint64_t>("balance") == 99);
+        REQUIRE_FALSE(account1.Write(FIELDS::TOKEN, uint256_t(5)));
+    }
+
+
+    //variable length members are part of the shape
+    {
+        Object name1;
+        name1 << std::string("namespace") << uint8_t(TYPES::STRING) << std::string("")
+              << std::string("name")      << uint8_t(TYPES::STRING) << std::string("abc")
+              << std::string("address")   << uint8_t(TYPES::MUTABLE) << uint8_t(TYPES::UINT256_T) << uint256_t(0);
+
+        Object name2;
+        name2 << std::string("namespace") << uint8_t(TYPES::STRING) << std::string("")
+              << std::string("name")      << uint8_t(TYPES::STRING) << std::string("xyz")
+              << std::string("address")   << uint8_t(TYPES::MUTABLE) << uint8_t(TYPES::UINT256_T) << uint256_t(0);
+
+        Object name3;
+        name3 << std::string("namespace") << uint8_t(TYPES::STRING) << std::string("")
+              << std::string("name")      << uint8_t(TYPES::STRING) << std::string("abcdef")
+              << std::string("address")   << uint8_t(TYPES::MUTABLE) << uint8_t(TYPES::UINT256_T) << uint256_t(7);
+
+        REQUIRE(name1.Parse());
+        REQUIRE(name2.Parse());
+        REQUIRE(name3.Parse());
+
+        //check layouts
+        REQUIRE(name1.pLayout == name2.pLayout);
+        REQUIRE(name1.pLayout != name3.pLayout);
+        REQUIRE(name3.Standard() == OBJECTS::NAME);
+
+        //check values
+        REQUIRE(name2.get<std::string>(FIELDS::NAME) == "xyz");
+        REQUIRE(name3.get<std::string>("name") == "abcdef");
+        REQUIRE(name3.get<uint256_t>(FIELDS::ADDRESS) == 7);
+    }
+
+
+    //duplicate members are rejected
+    {
+        Object object;
+        object << std::string("balance") << uint8_t(TYPES::UINT64_T) << uint64_t(55)
+               << std::string("balance") << uint8_t(TYPES::UINT64_T) << uint64_t(55);
+
+        REQUIRE_FALSE(object.Parse());
+    }
+}